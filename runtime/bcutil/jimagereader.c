@@ -170,17 +170,30 @@ j9bcutil_loadJImage(J9PortLibrary *portlib, const char *fileName, J9JImage **pji
 	jimage->fileLength = fileSize;
 	j9jimageHeader = jimage->j9jimageHeader = (J9JImageHeader *)((U_8 *)jimage + sizeof(J9JImage) + (fileNameLen + 1));
 
-	/* Map JImage header, redirect table, locationsOffsetTable, ImageLocations and Strings
-	 * Format of the above structures in jimage is:
-	 * 	| JImageHeader | Redirect Table (s4*tableLength) | LocationsOffsetTable (u4*tableLength) | Locations | Strings | ... |
+	/* Map the whole jimage read-only so that resources can be copied directly out of the mapping,
+	 * avoiding a seek and read on the shared file descriptor for every resource.
 	 */
-	mapSize = JIMAGE_RESOURCE_AREA_OFFSET(header);
-	pageSize = j9mmap_get_region_granularity(j9jimageHeader);
-	if (0 != pageSize) {
-		mapSize = ROUND_UP_TO(pageSize, mapSize);
+	if ((U_64)fileSize <= (U_64)UDATA_MAX) {
+		jimage->jimageMmap = j9mmap_map_file(jimagefd, 0, (UDATA)fileSize, fileName, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_CLASSES);
 	}
+	if (NULL != jimage->jimageMmap) {
+		jimage->jimageMmapSize = (U_64)fileSize;
+	} else {
+		Trc_BCU_loadJImage_JImageFullMmapFailed(fileSize, fileName);
+
+		/* Map JImage header, redirect table, locationsOffsetTable, ImageLocations and Strings
+		 * Format of the above structures in jimage is:
+		 * 	| JImageHeader | Redirect Table (s4*tableLength) | LocationsOffsetTable (u4*tableLength) | Locations | Strings | ... |
+		 */
+		mapSize = JIMAGE_RESOURCE_AREA_OFFSET(header);
+		pageSize = j9mmap_get_region_granularity(j9jimageHeader);
+		if (0 != pageSize) {
+			mapSize = ROUND_UP_TO(pageSize, mapSize);
+		}
 
-	jimage->jimageMmap = j9mmap_map_file(jimagefd, 0, mapSize, fileName, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_CLASSES);
+		jimage->jimageMmap = j9mmap_map_file(jimagefd, 0, mapSize, fileName, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_CLASSES);
+		jimage->jimageMmapSize = JIMAGE_RESOURCE_AREA_OFFSET(header);
+	}
 	if (NULL == jimage->jimageMmap) {
 		I_32 portlibErrCode = j9error_last_error_number();
 		const char *portlibErrMsg = j9error_last_error_message();
@@ -536,6 +549,8 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 	JImageHeader *jimageHeader = NULL;
 	I_64 seekResult = -1;
 	IDATA bytesRead = 0;
+	U_64 storedSize = 0;
+	U_8 *mappedResource = NULL;
 	U_8 *inputBuffer = NULL;
 	U_8 *outputBuffer = NULL;
 	I_32 rc = J9JIMAGE_NO_ERROR;
@@ -550,13 +565,19 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 	j9jimageHeader = jimage->j9jimageHeader;
 	jimageHeader = j9jimageHeader->jimageHeader;
 
-	seekResult = j9file_seek(jimage->fd, (I_64)j9jimageLocation->resourceOffset, EsSeekSet);
-	if (-1 == seekResult) {
-		I_32 portlibErrCode = j9error_last_error_number();
-		const char *portlibErrMsg = j9error_last_error_message();
-		Trc_BCU_getJImageResource_JImageFileSeekFailed(jimage->fileName, j9jimageLocation->resourceOffset, portlibErrCode, portlibErrMsg);
-		rc = J9JIMAGE_FILE_SEEK_ERROR;
-		goto _end;
+	/* Resources covered by the mapping are copied from it directly; otherwise fall back to reading the file */
+	storedSize = (0 != j9jimageLocation->compressedSize) ? j9jimageLocation->compressedSize : j9jimageLocation->uncompressedSize;
+	if ((j9jimageLocation->resourceOffset <= jimage->jimageMmapSize) && (storedSize <= (jimage->jimageMmapSize - j9jimageLocation->resourceOffset))) {
+		mappedResource = (U_8 *)jimageHeader + j9jimageLocation->resourceOffset;
+	} else {
+		seekResult = j9file_seek(jimage->fd, (I_64)j9jimageLocation->resourceOffset, EsSeekSet);
+		if (-1 == seekResult) {
+			I_32 portlibErrCode = j9error_last_error_number();
+			const char *portlibErrMsg = j9error_last_error_message();
+			Trc_BCU_getJImageResource_JImageFileSeekFailed(jimage->fileName, j9jimageLocation->resourceOffset, portlibErrCode, portlibErrMsg);
+			rc = J9JIMAGE_FILE_SEEK_ERROR;
+			goto _end;
+		}
 	}
 
 	if (0 != j9jimageLocation->compressedSize) {
@@ -569,7 +590,12 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 			rc = J9JIMAGE_OUT_OF_MEMORY;
 			goto _end;
 		}
-		bytesRead = j9file_read(jimage->fd, inputBuffer, (UDATA)j9jimageLocation->compressedSize);
+		if (NULL != mappedResource) {
+			memcpy(inputBuffer, mappedResource, (UDATA)j9jimageLocation->compressedSize);
+			bytesRead = (IDATA)j9jimageLocation->compressedSize;
+		} else {
+			bytesRead = j9file_read(jimage->fd, inputBuffer, (UDATA)j9jimageLocation->compressedSize);
+		}
 		if (j9jimageLocation->compressedSize != bytesRead) {
 			I_32 portlibErrCode = j9error_last_error_number();
 			const char *portlibErrMsg = j9error_last_error_message();
@@ -633,7 +659,12 @@ j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLoc
 		} while (0 == decompressorInfo->decompressorFlag);
 	} else {
 		IDATA bytesToRead = (dataBufferSize < j9jimageLocation->uncompressedSize) ? (IDATA)dataBufferSize : (IDATA)j9jimageLocation->uncompressedSize;
-		bytesRead = j9file_read(jimage->fd, dataBuffer, bytesToRead);
+		if (NULL != mappedResource) {
+			memcpy(dataBuffer, mappedResource, bytesToRead);
+			bytesRead = bytesToRead;
+		} else {
+			bytesRead = j9file_read(jimage->fd, dataBuffer, bytesToRead);
+		}
 		if (bytesToRead != bytesRead) {
 			I_32 portlibErrCode = j9error_last_error_number();
 			const char *portlibErrMsg = j9error_last_error_message();
@@ -827,6 +858,7 @@ j9bcutil_unloadJImage(J9PortLibrary *portlib, J9JImage *jimage)
 		}
 		jimage->fileName = NULL;
 		jimage->fileLength = 0;
+		jimage->jimageMmapSize = 0;
 		jimage->j9jimageHeader = NULL;
 		j9mem_free_memory(jimage);
 	}
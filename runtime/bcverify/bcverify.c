@@ -2072,6 +2072,7 @@ allocateVerifyBuffers (J9PortLibrary * portLib, J9BytecodeVerificationData *veri
 	verifyData->classNameSegment = 0;
 	verifyData->classNameSegmentFree = 0;
 	verifyData->classNameSegmentEnd = 0;
+	verifyData->compatibilityCache = 0;
 	verifyData->bytecodeMap = 0;
 	verifyData->stackMaps = 0;
 	verifyData->liveStack = 0;
@@ -2085,6 +2086,8 @@ allocateVerifyBuffers (J9PortLibrary * portLib, J9BytecodeVerificationData *veri
 	verifyData->classNameSegmentEnd = verifyData->classNameSegment + CLASSNAMESEGMENT_DEFAULT_SIZE;
 	verifyData->classNameSegmentFree = verifyData->classNameSegment;
 
+	verifyData->compatibilityCache = bcvalloc (verifyData, (UDATA) BCV_COMPATIBILITY_CACHE_SIZE);
+
 	verifyData->bytecodeMap = bcvalloc (verifyData, (UDATA) BYTECODE_MAP_DEFAULT_SIZE);
 	verifyData->bytecodeMapSize = BYTECODE_MAP_DEFAULT_SIZE;
 
@@ -2108,7 +2111,7 @@ allocateVerifyBuffers (J9PortLibrary * portLib, J9BytecodeVerificationData *veri
 
 	verifyData->portLib = portLib;
 
-	if (!(verifyData->classNameList && verifyData->classNameSegment && verifyData->bytecodeMap 
+	if (!(verifyData->classNameList && verifyData->classNameSegment && verifyData->compatibilityCache && verifyData->bytecodeMap 
 			&& verifyData->stackMaps && verifyData->unwalkedQueue && verifyData->rewalkQueue && verifyData->liveStack)) {
 		freeVerifyBuffers (portLib, verifyData);
 		Trc_BCV_allocateVerifyBuffers_allocFailure(verifyData->vmStruct);
@@ -2228,6 +2231,10 @@ freeVerifyBuffers (J9PortLibrary * portLib, J9BytecodeVerificationData *verifyDa
 		bcvfree (verifyData, verifyData->classNameSegment);
 	}
 
+	if (verifyData->compatibilityCache ) {
+		bcvfree (verifyData, verifyData->compatibilityCache);
+	}
+
 	if (verifyData->bytecodeMap ) {
 		bcvfree (verifyData, verifyData->bytecodeMap);
 	}
@@ -2253,6 +2260,7 @@ freeVerifyBuffers (J9PortLibrary * portLib, J9BytecodeVerificationData *verifyDa
 	verifyData->classNameSegment = 0;
 	verifyData->classNameSegmentFree = 0;
 	verifyData->classNameSegmentEnd = 0;
+	verifyData->compatibilityCache = 0;
 	verifyData->bytecodeMap = 0;
 	verifyData->stackMaps = 0;
 	verifyData->liveStack = 0;
@@ -40,6 +40,14 @@
 extern "C" {
 #endif
 
+/* Direct-mapped cache of isClassCompatible() results, keyed by the classNameList
+ * encoded source and target types. Each entry is {source, target, result}.
+ * An entry whose source is BCV_BASE_TYPE_NULL is empty, as NULL is never cached.
+ */
+#define BCV_COMPATIBILITY_CACHE_ENTRIES		64
+#define BCV_COMPATIBILITY_CACHE_ENTRY_SIZE	3
+#define BCV_COMPATIBILITY_CACHE_SIZE		(BCV_COMPATIBILITY_CACHE_ENTRIES * BCV_COMPATIBILITY_CACHE_ENTRY_SIZE * sizeof(UDATA))
+
 /**
  * Store verification failure info to the J9BytecodeVerificationData
  * structure for outputting detailed error message.
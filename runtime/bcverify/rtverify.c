@@ -59,11 +59,15 @@ j9rtv_verifierGetRAMClass( J9BytecodeVerificationData *verifyData, J9ClassLoader
 	J9Class *found;
 	JavaVM* jniVM = (JavaVM*)verifyData->javaVM;
     J9ThreadEnv* threadEnv;
+	/* If -XX:+FastClassHashTable is enabled, the class table can be sniffed without locking */
+	BOOLEAN fastMode = J9_ARE_ALL_BITS_SET(verifyData->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE);
 	(*jniVM)->GetEnv(jniVM, (void**)&threadEnv, J9THREAD_VERSION_1_1);
 
 
 #ifdef J9VM_THR_PREEMPTIVE
-	threadEnv->monitor_enter(verifyData->vmStruct->javaVM->classTableMutex);
+	if (!fastMode) {
+		threadEnv->monitor_enter(verifyData->vmStruct->javaVM->classTableMutex);
+	}
 #endif
 
 	/* Sniff the class table to see if already loaded */
@@ -71,7 +75,9 @@ j9rtv_verifierGetRAMClass( J9BytecodeVerificationData *verifyData, J9ClassLoader
 	found = verifyData->vmStruct->javaVM->internalVMFunctions->hashClassTableAt (classLoader, className, nameLength);
 
 #ifdef J9VM_THR_PREEMPTIVE
-	threadEnv->monitor_exit(verifyData->vmStruct->javaVM->classTableMutex);
+	if (!fastMode) {
+		threadEnv->monitor_exit(verifyData->vmStruct->javaVM->classTableMutex);
+	}
 #endif
 
 	if (!found) {
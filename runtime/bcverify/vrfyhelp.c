@@ -48,6 +48,8 @@ static IDATA findFieldFromRamClass (J9Class ** ramClass, J9ROMFieldRef * field,
 static IDATA findMethodFromRamClass (J9BytecodeVerificationData * verifyData, J9Class ** ramClass, J9ROMNameAndSignature * method, UDATA firstSearch);
 static VMINLINE UDATA * pushType (J9BytecodeVerificationData *verifyData, U_8 * signature, UDATA * stackTop);
 static IDATA isRAMClassCompatible(J9BytecodeVerificationData *verifyData, U_8* parentClass, UDATA parentLength, U_8* childClass, UDATA childLength, IDATA *reasonCode);
+static VMINLINE UDATA * findCompatibilityCacheEntry (J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDATA targetClass);
+static VMINLINE IDATA recordCompatibilityResult (J9BytecodeVerificationData *verifyData, UDATA *cacheEntry, UDATA sourceClass, UDATA targetClass, IDATA result, IDATA *reasonCode);
 
 J9_DECLARE_CONSTANT_UTF8(j9_vrfy_Object, "java/lang/Object");
 J9_DECLARE_CONSTANT_UTF8(j9_vrfy_String, "java/lang/String");
@@ -366,10 +368,17 @@ initializeClassNameList(J9BytecodeVerificationData *verifyData)
 {
 	J9UTF8 *name;
 
+	UDATA i;
+
 	/* reset the pointer and zero terminate the class name list */
 	verifyData->classNameSegmentFree = verifyData->classNameSegment;
 	verifyData->classNameList[0] = NULL;
 
+	/* Cached compatibility results are keyed by classNameList indices, so they are only valid for this class */
+	for (i = 0; i < BCV_COMPATIBILITY_CACHE_ENTRIES; i++) {
+		verifyData->compatibilityCache[i * BCV_COMPATIBILITY_CACHE_ENTRY_SIZE] = BCV_BASE_TYPE_NULL;
+	}
+
 	/* Add the "known" classes to the classNameList.  The order
 	 * here must exactly match the indexes as listed in bytecodewalk.h.
 	 */
@@ -454,6 +463,7 @@ isClassCompatible(J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDA
 	IDATA rc;
 	U_8 *sourceName, *targetName;
 	UDATA sourceLength, targetLength;
+	UDATA *cacheEntry;
 
 	*reasonCode = 0;
 
@@ -494,6 +504,12 @@ isClassCompatible(J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDA
 		return (IDATA) FALSE;
 	}
 
+	/* The remaining checks may need to look up (and load) classes, so reuse any earlier answer */
+	cacheEntry = findCompatibilityCacheEntry(verifyData, sourceClass, targetClass);
+	if ((sourceClass == cacheEntry[0]) && (targetClass == cacheEntry[1])) {
+		return (IDATA) cacheEntry[2];
+	}
+
 	/* load up the indices, but be aware that these might be base type arrays */
 	sourceIndex = J9CLASS_INDEX_FROM_CLASS_ENTRY(sourceClass);
 	targetIndex = J9CLASS_INDEX_FROM_CLASS_ENTRY(targetClass);
@@ -537,10 +553,10 @@ isClassCompatible(J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDA
 			if (((CLONEABLE_CLASS_NAME_LENGTH == targetLength) && ((0 == strncmp((const char*)targetName, CLONEABLE_CLASS_NAME, CLONEABLE_CLASS_NAME_LENGTH))))
 			|| ((SERIALIZEABLE_CLASS_NAME_LENGTH == targetLength) && (0 == strncmp((const char*)targetName, SERIALIZEABLE_CLASS_NAME, SERIALIZEABLE_CLASS_NAME_LENGTH)))
 			) {
-				return (IDATA) TRUE;
+				return recordCompatibilityResult(verifyData, cacheEntry, sourceClass, targetClass, (IDATA) TRUE, reasonCode);
 			}
 		}
-		return (IDATA) FALSE;
+		return recordCompatibilityResult(verifyData, cacheEntry, sourceClass, targetClass, (IDATA) FALSE, reasonCode);
 	}
 
 	/* At this point we know the arity is equal -- see if either is a base type array */
@@ -558,7 +574,7 @@ isClassCompatible(J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDA
 	/* if the target is an interface, be permissive */
 	rc = isInterfaceClass(verifyData, targetName, targetLength, reasonCode);
 	if (rc != (IDATA) FALSE) {
-		return rc;
+		return recordCompatibilityResult(verifyData, cacheEntry, sourceClass, targetClass, rc, reasonCode);
 	}
 
 	if (NULL != verifyData->vmStruct->currentException) {
@@ -567,7 +583,41 @@ isClassCompatible(J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDA
 
 	getNameAndLengthFromClassNameList (verifyData, sourceIndex, &sourceName, &sourceLength);
 
-	return isRAMClassCompatible(verifyData, targetName, targetLength , sourceName, sourceLength, reasonCode);
+	rc = isRAMClassCompatible(verifyData, targetName, targetLength , sourceName, sourceLength, reasonCode);
+	return recordCompatibilityResult(verifyData, cacheEntry, sourceClass, targetClass, rc, reasonCode);
+}
+
+
+/*
+ * Answer the compatibility cache entry that sourceClass and targetClass map to.
+ * The caller must compare the entry's source and target to detect a hit.
+ */
+static VMINLINE UDATA *
+findCompatibilityCacheEntry(J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDATA targetClass)
+{
+	UDATA hash = ((sourceClass >> BCV_CLASS_INDEX_SHIFT) * 31) + (targetClass >> BCV_CLASS_INDEX_SHIFT);
+
+	return verifyData->compatibilityCache + ((hash & (BCV_COMPATIBILITY_CACHE_ENTRIES - 1)) * BCV_COMPATIBILITY_CACHE_ENTRY_SIZE);
+}
+
+
+/*
+ * Remember the result of a compatibility check for the rest of the current class.
+ * Results are only recorded when the class lookups succeeded: a failed load (OOM, pending
+ * exception) must be reported again by any later check. The class loader of the class being
+ * verified resolves a name to the same class for the whole verification, so a successful
+ * answer does not change.
+ * Returns result.
+ */
+static VMINLINE IDATA
+recordCompatibilityResult(J9BytecodeVerificationData *verifyData, UDATA *cacheEntry, UDATA sourceClass, UDATA targetClass, IDATA result, IDATA *reasonCode)
+{
+	if ((0 == *reasonCode) && (NULL == verifyData->vmStruct->currentException)) {
+		cacheEntry[0] = sourceClass;
+		cacheEntry[1] = targetClass;
+		cacheEntry[2] = (UDATA) result;
+	}
+	return result;
 }
 
 /*
@@ -28,7 +28,8 @@ set(J9VM_ENV_LITTLE_ENDIAN ON CACHE BOOL "")
 
 set(OMR_GC_IDLE_HEAP_MANAGER ON CACHE BOOL "")
 set(OMR_GC_TLH_PREFETCH_FTA ON CACHE BOOL "")
-set(J9VM_PORT_RUNTIME_INSTRUMENTATION OFF CACHE BOOL "")
+set(J9VM_JIT_RUNTIME_INSTRUMENTATION ON CACHE BOOL "")
+set(J9VM_PORT_RUNTIME_INSTRUMENTATION ON CACHE BOOL "")
 set(J9VM_MODULE_CODEGEN_IA32 ON CACHE BOOL "")
 set(J9VM_MODULE_CODERT_IA32 ON CACHE BOOL "")
 set(J9VM_MODULE_JIT_IA32 ON CACHE BOOL "")
@@ -28,3 +28,8 @@ else
     compiler/x/amd64/runtime/AMD64Recompilation.asm
 
 endif
+
+# The perf_event HW profiler is only built where jit_runtimeInstrumentation is enabled, i.e. 64-bit Linux
+ifeq ($(OS),linux)
+    JIT_PRODUCT_SOURCE_FILES+=compiler/x/runtime/X86HWProfiler.cpp
+endif
@@ -210,6 +210,8 @@ uint32_t J9::Options::_hwprofilerPRISamplingRate            = 500000;
 
 int32_t J9::Options::_hwProfilerBufferMaxPercentageToDiscard = 5;
 uint32_t J9::Options::_hwProfilerExpirationTime             = 0; // ms;  0 means disabled
+uint32_t J9::Options::_hwprofilerX86SamplingPeriod         = 1000000; // ns of thread CPU time
+uint32_t J9::Options::_hwprofilerX86BufferSize             = 512; // samples
 uint32_t J9::Options::_hwprofilerZRIBufferSize              = 4 * 1024; // 4 kb
 uint32_t J9::Options::_hwprofilerZRIMode                    = 0; // cycle based profiling
 uint32_t J9::Options::_hwprofilerZRIRGS                     = 0; // only collect instruction records
@@ -798,6 +800,10 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_hwprofilerScorchingOptLevelThreshold, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerWarmOptLevelThreshold=", "O<nnn>\tWarm Opt Level Threshold",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_hwprofilerWarmOptLevelThreshold, 0, "F%d", NOT_IN_SUBSET},
+   {"HWProfilerX86BufferSize=",       "O<nnn>\tx86 HW Profiler Buffer Size, in samples",
+        TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_hwprofilerX86BufferSize, 0, "F%d", NOT_IN_SUBSET},
+   {"HWProfilerX86SamplingPeriod=",   "O<nnn>\tx86 HW Profiler Sampling Period, in ns of thread CPU time",
+        TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_hwprofilerX86SamplingPeriod, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerZRIBufferSize=",       "O<nnn>\tZ RI Buffer Size",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_hwprofilerZRIBufferSize, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerZRIMode=",             "O<nnn>\tZ RI Mode",
@@ -288,6 +288,8 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static uint32_t _hwProfilerExpirationTime;
 
    static uint32_t _hwprofilerRIBufferThreshold;
+   static uint32_t _hwprofilerX86SamplingPeriod;
+   static uint32_t _hwprofilerX86BufferSize;
    static uint32_t _hwprofilerZRIBufferSize;
    static uint32_t _hwprofilerZRIMode;
    static uint32_t _hwprofilerZRIRGS;
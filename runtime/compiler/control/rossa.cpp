@@ -76,6 +76,8 @@
 #elif defined(TR_HOST_POWER)
 #include "p/runtime/PPCHWProfiler.hpp"
 #include "p/runtime/PPCLMGuardedStorage.hpp"
+#elif defined(TR_HOST_X86) && defined(TR_HOST_64BIT) && defined(LINUX)
+#include "x/runtime/X86HWProfiler.hpp"
 #endif
 
 #include "control/rossa.h"
@@ -1536,6 +1538,8 @@ onLoadInternal(
 #else
       ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->hwProfiler = NULL;
 #endif /* !defined(J9OS_I5_V6R1) && !defined(J9OS_I5_V7R2) */
+#elif defined(TR_HOST_X86) && defined(TR_HOST_64BIT) && defined(LINUX)
+      ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->hwProfiler = TR_X86HWProfiler::allocate(jitConfig);
 #endif
 
       //Initialize VM support for RI.
@@ -73,6 +73,7 @@
 #define BC_HASH_TABLE_SIZE  34501 // 131071// 34501
 #undef  IPROFILER_CONTENDED_LOCKING
 #define ALLOC_HASH_TABLE_SIZE 1201
+#define IPROFILER_PERSIST_REFRESH_GROWTH_FACTOR 2 // replace a persisted profile once the live one is this many times larger
 #define TEST_verbose 0
 #define TEST_callsite 0
 #define TEST_statistics 0
@@ -154,6 +155,7 @@ int32_t TR_IProfiler::_STATS_cannotGetClassInfo             = 0;
 int32_t TR_IProfiler::_STATS_timestampHasExpired            = 0;
 int32_t TR_IProfiler::_STATS_abortedPersistence             = 0;
 int32_t TR_IProfiler::_STATS_methodPersisted                = 0;
+int32_t TR_IProfiler::_STATS_methodPersistedRefresh         = 0;
 int32_t TR_IProfiler::_STATS_persistError                   = 0;
 int32_t TR_IProfiler::_STATS_methodPersistenceAttempts      = 0;
 int32_t TR_IProfiler::_STATS_methodNotPersisted_SCCfull     = 0;
@@ -412,7 +414,11 @@ TR_IProfiler::persistIprofileInfo(TR::ResolvedMethodSymbol *resolvedMethodSymbol
          J9VMThread *vmThread = ((TR_J9VM *)comp->fej9())->getCurrentVMThread();
          IDATA dataIsCorrupt;
          const U_8 *found = scConfig->findAttachedData(vmThread, romMethod, &descriptor, &dataIsCorrupt);
-         if (!found)
+         // A profile persisted early in the life of a method may be much sparser than the one
+         // gathered since. If the previous record fit in our buffer, walk the current profile
+         // and replace the record when it has grown enough to be worth the cache space.
+         uint32_t storedLength = (found == storeBuffer) ? descriptor.length : 0;
+         if (!found || storedLength)
             {
             if (traceIProfiling && resolvedMethodSymbol)
                comp->dumpMethodTrees("Pre Iprofiler Walk", resolvedMethodSymbol);
@@ -432,7 +438,16 @@ TR_IProfiler::persistIprofileInfo(TR::ResolvedMethodSymbol *resolvedMethodSymbol
             bytesFootprint += walkILTreeForEntries(pcEntries, numEntries, &bci, method, comp, cacheOffset, cacheSize,
                                                       visitCount, -1, BCvisit, abort);
 
-            if (numEntries && !abort)
+            // Readers fetch the record into a buffer of bufferLength bytes, so never replace it with one they cannot read
+            if (storedLength &&
+                ((bytesFootprint < storedLength * IPROFILER_PERSIST_REFRESH_GROWTH_FACTOR) || (bytesFootprint > bufferLength)))
+               {
+               _STATS_methodNotPersisted_alreadyStored++;
+#ifdef PERSISTENCE_VERBOSE
+               fprintf(stderr, "\tNot Persisted: already stored\n");
+#endif
+               }
+            else if (numEntries && !abort)
                {
                uint32_t bytesToPersist = 0;
 
@@ -452,9 +467,11 @@ TR_IProfiler::persistIprofileInfo(TR::ResolvedMethodSymbol *resolvedMethodSymbol
                   // store in the shared cache
                   descriptor.address = (U_8 *) memChunk;
                   descriptor.length = bytesFootprint;
-                  UDATA store = scConfig->storeAttachedData(vmThread, romMethod, &descriptor, 0);
+                  UDATA store = scConfig->storeAttachedData(vmThread, romMethod, &descriptor, storedLength ? 1 : 0);
                   if (store == 0)
                      {
+                     if (storedLength)
+                        _STATS_methodPersistedRefresh++;
                      _STATS_methodPersisted++;
                      _STATS_entriesPersisted += numEntries;
 #ifdef PERSISTENCE_VERBOSE
@@ -698,6 +698,7 @@ private:
    static int32_t                  _STATS_timestampHasExpired;
    static int32_t                  _STATS_abortedPersistence;
    static int32_t                  _STATS_methodPersisted;
+   static int32_t                  _STATS_methodPersistedRefresh;
    static int32_t                  _STATS_methodNotPersisted_SCCfull;
    static int32_t                  _STATS_methodNotPersisted_classNotInSCC;
    static int32_t                  _STATS_methodNotPersisted_delayed;
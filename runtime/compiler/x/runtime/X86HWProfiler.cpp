@@ -0,0 +1,431 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "x/runtime/X86HWProfiler.hpp"
+
+#include "j9cfg.h"
+#include "j9port_generated.h"
+#include "util_api.h"
+#include "AtomicSupport.hpp"
+#include "control/CompilationRuntime.hpp"
+#include "control/Recompilation.hpp"
+#include "control/RecompilationInfo.hpp"
+#include "env/VMJ9.h"
+#include "env/jittypes.h"
+#include "env/VerboseLog.hpp"
+#include "infra/Annotations.hpp"
+
+#include <errno.h>
+#include <string.h>
+#include <syscall.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <linux/perf_event.h>
+
+#define VERBOSE(...)                                                                    \
+   do                                                                                   \
+      {                                                                                 \
+      if (OMR_UNLIKELY(TR::Options::isAnyVerboseOptionSet(TR_VerboseHWProfiler)))        \
+         {                                                                              \
+         TR_VerboseLog::writeLineLocked(TR_Vlog_HWPROFILER, __VA_ARGS__);               \
+         }                                                                              \
+      }                                                                                 \
+   while (0)
+
+// Number of data pages in each thread's perf ring buffer; must be a power of two
+#define X86HWPROFILER_RING_DATA_PAGES 8
+
+// Set in the riParameters flags of a thread whose perf ring buffer could not be mapped, so that it is not retried
+#define X86HWPROFILER_THREAD_SKIPPED ((U_32) 0x80000000)
+
+static int
+openTaskClockEvent()
+   {
+   struct perf_event_attr pe;
+
+   memset(&pe, 0, sizeof(struct perf_event_attr));
+   pe.type = PERF_TYPE_SOFTWARE;
+   pe.size = sizeof(struct perf_event_attr);
+   pe.config = PERF_COUNT_SW_TASK_CLOCK;
+   pe.sample_period = TR::Options::_hwprofilerX86SamplingPeriod;
+   pe.sample_type = PERF_SAMPLE_IP;
+   pe.exclude_kernel = 1;
+   pe.exclude_hv = 1;
+
+   // Sample the calling thread only, on whichever CPU it runs
+   return syscall(SYS_perf_event_open, &pe, 0, -1, -1, 0);
+   }
+
+TR_X86HWProfiler *
+TR_X86HWProfiler::allocate(J9JITConfig *jitConfig)
+   {
+   // Probe once up front so that a kernel without perf events, or a perf_event_paranoid
+   // setting that forbids them, disables the HW Profiler rather than failing on every thread.
+   int fd = openTaskClockEvent();
+   if (fd < 0)
+      {
+      VERBOSE("Failed to open a software clock perf event, errno: %d, perf_event_open : %s.", errno, strerror(errno));
+      return NULL;
+      }
+   close(fd);
+
+   TR_X86HWProfiler *profiler = new (PERSISTENT_NEW) TR_X86HWProfiler(jitConfig);
+   VERBOSE("HWProfiler initialized, sampling period %u ns.", TR::Options::_hwprofilerX86SamplingPeriod);
+
+   return profiler;
+   }
+
+TR_X86HWProfiler::TR_X86HWProfiler(J9JITConfig *jitConfig)
+   : TR_HWProfiler(jitConfig),
+     _x86HWProfilerBufferMemoryAllocated(0), _x86HWProfilerBufferMaximumMemory(TR::Options::_hwprofilerRIBufferPoolSize),
+     _STATS_TotalSamples(0), _STATS_TotalLostSamples(0), _STATS_TotalJittedSamples(0)
+   {}
+
+bool
+TR_X86HWProfiler::initializeThread(J9VMThread *vmThread)
+   {
+   if (IS_THREAD_RI_INITIALIZED(vmThread))
+      return true;
+
+   if (vmThread->riParameters->flags & X86HWPROFILER_THREAD_SKIPPED)
+      return false;
+
+   // If we've already hit our memory budget don't even try to go further
+   if (_x86HWProfilerBufferMemoryAllocated >= _x86HWProfilerBufferMaximumMemory)
+      return false;
+
+   uintptrj_t                pageSize = sysconf(_SC_PAGESIZE);
+   uintptrj_t                ringSize = (1 + X86HWPROFILER_RING_DATA_PAGES) * pageSize;
+   uint64_t                  bufferSizeInBytes = TR::Options::_hwprofilerX86BufferSize * sizeof(uintptrj_t);
+   TR_X86HWProfilerContext  *context = NULL;
+   void                     *ring = MAP_FAILED;
+   uintptrj_t               *buffer = NULL;
+   bool                      setUnavailableOnFail = true;
+
+   int fd = openTaskClockEvent();
+   if (fd < 0)
+      {
+      VERBOSE("Failed to open perf interface for J9VMThread=%p, errno: %d, perf_event_open : %s.", vmThread, errno, strerror(errno));
+      goto fail;
+      }
+
+   ring = mmap(NULL, ringSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   if (MAP_FAILED == ring)
+      {
+      VERBOSE("Failed to map perf ring buffer for J9VMThread=%p, errno: %d, mmap : %s.", vmThread, errno, strerror(errno));
+      // Mapping is limited per user (perf_event_mlock_kb), so other threads may still succeed; only skip this one
+      setUnavailableOnFail = false;
+      vmThread->riParameters->flags |= X86HWPROFILER_THREAD_SKIPPED;
+      goto closefd;
+      }
+
+   buffer = (uintptrj_t *)allocateBuffer(bufferSizeInBytes);
+   if (!buffer)
+      {
+      VERBOSE("Failed to allocate buffer for J9VMThread=%p.", vmThread);
+      // Don't have enough memory now, but might in the future, so don't disable HWP completely
+      setUnavailableOnFail = false;
+      goto unmap;
+      }
+
+   context = (TR_X86HWProfilerContext *)jitPersistentAlloc(sizeof(TR_X86HWProfilerContext));
+   if (!context)
+      {
+      VERBOSE("Failed to allocate context for J9VMThread=%p.", vmThread);
+      setUnavailableOnFail = false;
+      goto freebuf;
+      }
+
+   context->fd = fd;
+   context->ring = (uint8_t *)ring;
+   context->ringSize = ringSize;
+   context->buffer = buffer;
+   context->spaceLeft = TR::Options::_hwprofilerX86BufferSize;
+   context->lostSamples = 0;
+
+   vmThread->riParameters->controlBlock = context;
+   vmThread->riParameters->flags |= (J9PORT_RI_INITIALIZED | J9PORT_RI_ENABLED);
+
+   VERBOSE("J9VMThread=%p, initialized for HW profiling.", vmThread);
+   return true;
+
+freebuf:
+   freeBuffer(buffer, bufferSizeInBytes);
+unmap:
+   munmap(ring, ringSize);
+closefd:
+   close(fd);
+fail:
+   // Prevent any future threads from trying to initialize if we hit a failure that is not transient
+   if (setUnavailableOnFail)
+      {
+      VERBOSE("Failure on J9VMThread=%p was critical. HW profiling will be unavailable from now on.", vmThread);
+      setHWProfilingAvailable(false);
+      }
+   return false;
+   }
+
+bool
+TR_X86HWProfiler::deinitializeThread(J9VMThread *vmThread)
+   {
+   if (!IS_THREAD_RI_INITIALIZED(vmThread))
+      return true;
+
+   TR_X86HWProfilerContext *context = (TR_X86HWProfilerContext *)vmThread->riParameters->controlBlock;
+   VERBOSE("Retrieved context=%p for terminating J9VMThread=%p, lost samples: %llu.", context, vmThread, context->lostSamples);
+
+   ioctl(context->fd, PERF_EVENT_IOC_DISABLE, 0);
+   munmap(context->ring, context->ringSize);
+   if (close(context->fd))
+      VERBOSE("Failed to close perf interface (fd=%d) on J9VMThread=%p, errno: %d, close : %s.", context->fd, vmThread, errno, strerror(errno));
+   _STATS_TotalLostSamples += context->lostSamples;
+   freeBuffer(context->buffer, TR::Options::_hwprofilerX86BufferSize * sizeof(uintptrj_t));
+   jitPersistentFree(context);
+
+   vmThread->riParameters->flags &= ~(J9PORT_RI_INITIALIZED | J9PORT_RI_ENABLED);
+   vmThread->riParameters->controlBlock = NULL;
+
+   return !IS_THREAD_RI_INITIALIZED(vmThread);
+   }
+
+void
+TR_X86HWProfiler::drainRing(TR_X86HWProfilerContext *context)
+   {
+   struct perf_event_mmap_page *control = (struct perf_event_mmap_page *)context->ring;
+   uintptrj_t                   pageSize = sysconf(_SC_PAGESIZE);
+   uint8_t                     *data = context->ring + pageSize;
+   uint64_t                     dataSize = context->ringSize - pageSize;
+   uint32_t                     bufferSize = TR::Options::_hwprofilerX86BufferSize;
+
+   uint64_t head = control->data_head;
+   // Make sure the records written by the kernel are visible before reading them
+   VM_AtomicSupport::readBarrier();
+   uint64_t tail = control->data_tail;
+
+   // Records are 8 byte aligned and the data area is a whole number of pages, so a header or
+   // a 64 bit field never straddles the end of the ring.
+   while (tail < head)
+      {
+      struct perf_event_header *record = (struct perf_event_header *)(data + (tail % dataSize));
+      if (OMR_UNLIKELY(0 == record->size))
+         break;
+
+      if (PERF_RECORD_SAMPLE == record->type)
+         {
+         uint64_t ip = *(uint64_t *)(data + ((tail + sizeof(struct perf_event_header)) % dataSize));
+         if (context->spaceLeft > 0)
+            {
+            context->buffer[bufferSize - context->spaceLeft] = (uintptrj_t)ip;
+            context->spaceLeft--;
+            }
+         else
+            {
+            context->lostSamples++;
+            }
+         }
+      else if (PERF_RECORD_LOST == record->type)
+         {
+         // struct { perf_event_header header; u64 id; u64 lost; }
+         uint64_t lost = *(uint64_t *)(data + ((tail + sizeof(struct perf_event_header) + sizeof(uint64_t)) % dataSize));
+         context->lostSamples += lost;
+         }
+
+      tail += record->size;
+      }
+
+   // Finish reading the records before handing the space back to the kernel
+   VM_AtomicSupport::readWriteBarrier();
+   control->data_tail = tail;
+   }
+
+bool
+TR_X86HWProfiler::processBuffers(J9VMThread *vmThread, TR_J9VMBase *fe)
+   {
+   TR_ASSERT(IS_THREAD_RI_INITIALIZED(vmThread), "processBuffers() called on uninitialized thread");
+   TR_ASSERT((vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS), "Must have vm access!");
+
+   TR_X86HWProfilerContext *context = (TR_X86HWProfilerContext *)vmThread->riParameters->controlBlock;
+
+   drainRing(context);
+
+   uint32_t bufferSize = TR::Options::_hwprofilerX86BufferSize;
+   uint32_t spaceLeft = context->spaceLeft;
+   float    bufferSpaceLeftPercentage = (float)spaceLeft / (float)bufferSize * 100.0f;
+   if (bufferSpaceLeftPercentage > (100 - TR::Options::_hwprofilerRIBufferThreshold))
+      return false;
+
+   uint32_t bufferSizeInBytes = bufferSize * sizeof(uintptrj_t);
+   uint32_t bufferFilledSizeInBytes = (bufferSize - spaceLeft) * sizeof(uintptrj_t);
+
+   _numRequests++;
+
+   uint8_t *newBuffer = swapBufferToWorkingQueue((U_8*)context->buffer,
+                                                  bufferSizeInBytes,
+                                                  bufferFilledSizeInBytes);
+   if (OMR_LIKELY(newBuffer != NULL))
+      {
+      context->buffer = (uintptrj_t *)newBuffer;
+      }
+   else if (TR::Options::getCmdLineOptions()->getOption(TR_DisableHWProfilerThread) ||
+            (100*_numRequestsSkipped) >= ((uint64_t)TR::Options::_hwProfilerBufferMaxPercentageToDiscard * _numRequests))
+      {
+      // Process buffer by application thread and reuse the buffer
+      processBufferRecords(vmThread, (U_8*)context->buffer, bufferSizeInBytes, bufferFilledSizeInBytes);
+      _STATS_BuffersProcessedByAppThread++;
+      }
+   else
+      {
+      _numRequestsSkipped++;
+      }
+   context->spaceLeft = bufferSize;
+
+   return false;
+   }
+
+void
+TR_X86HWProfiler::processBufferRecords(J9VMThread *vmThread, uint8_t *bufferStart, uintptrj_t size, uintptrj_t bufferFilledSize, uint32_t dataTag)
+   {
+   uintptrj_t          *samples = (uintptrj_t *)bufferStart;
+   uint32_t             numSamples = bufferFilledSize / sizeof(uintptrj_t);
+   TR_FrontEnd         *fe = TR_J9VMBase::get(_jitConfig, vmThread);
+   bool                 recompilationEnabled = false;
+   // Consecutive samples usually hit the same body; avoid repeating the metadata search for them
+   J9JITExceptionTable *lastMetaData = NULL;
+   J9JITExceptionTable *metaData;
+
+   if (_compInfo->getPersistentInfo()->isRuntimeInstrumentationRecompilationEnabled()
+       && vmThread != NULL
+       && fe != NULL)
+      {
+      recompilationEnabled = true;
+      }
+
+   for (uint32_t i = 0; i < numSamples; ++i)
+      {
+      if (lastMetaData && samples[i] >= lastMetaData->startPC && samples[i] <= lastMetaData->endPC)
+         {
+         metaData = lastMetaData;
+         }
+      else
+         {
+         metaData = jit_artifact_search(_jitConfig->translationArtifacts, samples[i]);
+         if (!metaData)
+            continue;
+         lastMetaData = metaData;
+         }
+
+      _STATS_TotalJittedSamples++;
+
+      TR::Recompilation::hwpGlobalSampleCount++;
+      if (recompilationEnabled && metaData->bodyInfo != NULL)
+         {
+         TR_PersistentJittedBodyInfo *bodyInfo = (TR_PersistentJittedBodyInfo *) metaData->bodyInfo;
+
+         bodyInfo->_hwpInstructionCount++;
+         if (recompilationLogic(bodyInfo,
+                                (void *) metaData->startPC,
+                                bodyInfo->_hwpInstructionStartCount,
+                                bodyInfo->_hwpInstructionCount,
+                                TR::Recompilation::hwpGlobalSampleCount,
+                                fe,
+                                vmThread))
+            {
+            // Start a new interval
+            bodyInfo->_hwpInstructionStartCount   = TR::Recompilation::hwpGlobalSampleCount;
+            bodyInfo->_hwpInstructionCount        = 0;
+            }
+         }
+      }
+
+   _STATS_TotalSamples += numSamples;
+   _STATS_TotalEntriesProcessed += numSamples;
+   if (bufferFilledSize >= size)
+      _numBuffersCompletelyFilled++;
+
+   _bufferSizeSum += size;
+   _bufferFilledSum += bufferFilledSize;
+   ++_STATS_TotalBuffersProcessed;
+   }
+
+void *
+TR_X86HWProfiler::allocateBuffer(uint64_t size)
+   {
+   void * temp = NULL;
+
+   if (_hwProfilerMonitor)
+      {
+      if (_hwProfilerMonitor->try_enter())
+         return NULL;
+
+      // First try to get a buffer from the free list
+      HWProfilerBuffer *newHWProfilerBuffer = _freeBufferList.pop();
+      if (newHWProfilerBuffer)
+         {
+         temp = (void *)newHWProfilerBuffer->getBuffer();
+         TR_Memory::jitPersistentFree(newHWProfilerBuffer);
+         }
+      // Try to allocate a buffer from jitPersistentAlloc
+      else if (_x86HWProfilerBufferMemoryAllocated + size < _x86HWProfilerBufferMaximumMemory)
+         {
+         _x86HWProfilerBufferMemoryAllocated += size;
+         temp = (void*)TR_Memory::jitPersistentAlloc(size, TR_Memory::HWProfile);
+         }
+
+      _hwProfilerMonitor->exit();
+      }
+
+   return temp;
+   }
+
+void
+TR_X86HWProfiler::freeBuffer(void *buffer, uint64_t size)
+   {
+   if (_hwProfilerMonitor)
+      {
+      _hwProfilerMonitor->enter();
+
+      // Put the buffers into the free list for another thread
+      HWProfilerBuffer *newHWProfilerBuffer = (HWProfilerBuffer*)TR_Memory::jitPersistentAlloc(sizeof(HWProfilerBuffer));
+      if (newHWProfilerBuffer)
+         {
+         newHWProfilerBuffer->setBuffer((U_8*)buffer);
+         newHWProfilerBuffer->setSize(size);
+         newHWProfilerBuffer->setIsInvalidated(false);
+
+         _freeBufferList.add(newHWProfilerBuffer);
+         }
+
+      _hwProfilerMonitor->exit();
+      }
+   }
+
+void
+TR_X86HWProfiler::printStats()
+   {
+   printf ("\n");
+   printf ("X86 HW Profiler Stats\n");
+   printf ("Total samples processed         %llu\n", _STATS_TotalSamples);
+   printf ("Samples in jitted code          %llu\n", _STATS_TotalJittedSamples);
+   printf ("Samples lost by exited threads  %llu\n", _STATS_TotalLostSamples);
+   TR_HWProfiler::printStats();
+   }
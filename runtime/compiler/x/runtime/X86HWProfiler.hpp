@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef X86HWPROFILER_INCL
+#define X86HWPROFILER_INCL
+
+#include "runtime/HWProfiler.hpp"
+
+#include <stdint.h>
+#include "env/jittypes.h"
+
+class TR_J9VMBase;
+
+/**
+ * Per-thread sampling state. The kernel appends PERF_RECORD_SAMPLE records to the mapped ring
+ * buffer; processBuffers() copies the sampled instruction addresses into the current HW
+ * Profiler buffer on the application thread.
+ */
+struct TR_X86HWProfilerContext
+   {
+   int           fd;            // perf_event file descriptor for the thread's software clock
+   uint8_t      *ring;          // mmap'd perf metadata page followed by the data pages
+   uintptrj_t    ringSize;
+   uintptrj_t   *buffer;        // instruction addresses collected since the last swap
+   uint32_t      spaceLeft;     // in samples
+   uint64_t      lostSamples;
+   };
+
+/**
+ * HW Profiler for Linux on x86. There is no runtime instrumentation facility on x86, so the
+ * samples come from a per-thread perf_event software clock (PERF_COUNT_SW_TASK_CLOCK), which
+ * records the instruction address of the thread once every sampling period of CPU time and
+ * needs no PMU access. Samples landing in JIT code feed TR_HWProfiler::recompilationLogic the
+ * same way the method hotness samples do on POWER.
+ */
+class TR_X86HWProfiler : public TR_HWProfiler
+   {
+public:
+   TR_PERSISTENT_ALLOC(TR_Memory::HWProfile);
+
+   /**
+    * Constructor.
+    * @param jitConfig the J9JITConfig
+    */
+   TR_X86HWProfiler(J9JITConfig *jitConfig);
+
+
+   // --------------------------------------------------------------------------------------
+   // HW Profiler Management Methods
+
+   /**
+    * Static method used to allocate the HW Profiler
+    * @param jitConfig The J9JITConfig
+    * @return pointer to the HWPRofiler, or NULL if perf events are not available
+    */
+   static TR_X86HWProfiler* allocate(J9JITConfig *jitConfig);
+
+   /**
+    * Open and map a software clock perf event for the given app thread.
+    * @param vmThread The VM thread to initialize profiling.
+    * @return true if initialization is successful; false otherwise.
+    */
+   virtual bool initializeThread(J9VMThread *vmThread);
+
+   /**
+    * Close the perf event of the given app thread and release its buffers.
+    * @param vmThread The VM thread to deinitialize profiling.
+    * @return true if deinitialization is successful; false otherwise.
+    */
+   virtual bool deinitializeThread(J9VMThread *vmThread);
+
+
+   // --------------------------------------------------------------------------------------
+   // HW Profiler Buffer Processing Methods
+
+   /**
+    * Drain the perf ring buffer of the given app thread and hand the collected samples to
+    * the profiling thread once the buffer reaches the processing threshold.
+    * @param vmThread The VM thread to query
+    * @param fe The Front End
+    * @return false; sampling never needs to be re-enabled by the caller
+    */
+   virtual bool processBuffers(J9VMThread *vmThread, TR_J9VMBase *fe);
+
+   /**
+    * Method to process a buffer of sampled instruction addresses.
+    * @param vmThread The VM thread
+    * @param dataStart The start of the data buffer.
+    * @param size      Size of the data buffer.
+    * @param bufferFilledSize The amount of the buffer that is filled
+    * @param dataTag   Unused.
+    */
+   virtual void processBufferRecords(J9VMThread *vmThread,
+                                     uint8_t *bufferStart,
+                                     uintptrj_t size,
+                                     uintptrj_t bufferFilledSize,
+                                     uint32_t dataTag = 0);
+
+   /**
+    * Method to allocate a buffer for HW Profiling. It first tries to pull a buffer from
+    * TR_HWPRofiler::_freeBufferList, then falls back to TR_Memory::jitPersistentAlloc within
+    * the budget given by -Xjit:HWProfilerRIBufferPoolSize.
+    * @param size The size of the buffer to be allocated
+    * @return a pointer to the buffer
+    */
+   virtual void* allocateBuffer(uint64_t size);
+
+   /**
+    * Method to free a buffer allocated for HW Profiling (places it into the free list).
+    * @param buffer The buffer to be freed
+    * @param Parameter for the size of the buffer to be freed
+    */
+   virtual void freeBuffer(void * buffer, uint64_t size = 0);
+
+
+   // --------------------------------------------------------------------------------------
+   // HW Profiler Miscellaneous Helper Methods
+
+   /**
+    * Prints out the x86 sampling stats and then calls TR_HWProfiler::printStats()
+    */
+   virtual void printStats();
+
+protected:
+
+   /**
+    * Copy the samples the kernel has written to the thread's ring buffer into the thread's
+    * current HW Profiler buffer.
+    * @param context The per-thread sampling state
+    */
+   void drainRing(TR_X86HWProfilerContext *context);
+
+   // Buffer Memory Allocated
+   uint64_t                 _x86HWProfilerBufferMemoryAllocated;
+   uint64_t                 _x86HWProfilerBufferMaximumMemory;
+
+   uint64_t                 _STATS_TotalSamples;
+   uint64_t                 _STATS_TotalLostSamples;
+   uint64_t                 _STATS_TotalJittedSamples;
+   };
+
+#endif /* X86HWPROFILER_INCL */
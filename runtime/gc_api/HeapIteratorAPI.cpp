@@ -29,6 +29,8 @@
 #include "ModronAssertions.h"
 
 #include "ArrayletLeafIterator.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapIteratorAPIRootIterator.hpp"
 #include "HeapIteratorAPIBufferedIterator.hpp"
@@ -43,6 +45,7 @@
 #include "MixedObjectIterator.hpp"
 #include "ObjectAccessBarrier.hpp"
 #include "OwnableSynchronizerObjectList.hpp"
+#include "ParallelTask.hpp"
 #include "PointerArrayIterator.hpp"
 #include "SlotObject.hpp"
 #include "VMInterface.hpp"
@@ -85,6 +88,64 @@ iterateRegionObjects(
 	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
 	void *userData);
 
+/**
+ * Walks the objects of one memory space on the GC worker threads for j9mm_parallel_iterate_all_objects.
+ * Regions are the unit of work; each worker keeps its own user context for the duration of the walk.
+ */
+class HeapIteratorAPI_ParallelWalkTask : public MM_ParallelTask
+{
+	/* Data Members */
+private:
+	J9JavaVM *_javaVM;
+	MM_HeapRegionManager *_manager;
+	MM_MemorySpace *_memorySpace;
+	UDATA _flags;
+	jvmtiIterationControl (*_func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *workerData);
+	void *(*_workerStart)(J9JavaVM *vm, void *userData);
+	void (*_workerFinish)(J9JavaVM *vm, void *workerData, void *userData);
+	void *_userData;
+	omrthread_monitor_t _reductionMutex; /**< Serializes the calls to _workerFinish */
+	volatile bool _aborted; /**< Set once any worker's callback aborts the walk of a region */
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+public:
+	virtual UDATA getVMStateID(void) { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; }
+	virtual void run(MM_EnvironmentBase *env);
+
+	bool wasAborted(void) { return _aborted; }
+
+	HeapIteratorAPI_ParallelWalkTask(
+		MM_EnvironmentBase *env,
+		MM_Dispatcher *dispatcher,
+		J9JavaVM *javaVM,
+		MM_HeapRegionManager *manager,
+		MM_MemorySpace *memorySpace,
+		UDATA flags,
+		jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *workerData),
+		void *(*workerStart)(J9JavaVM *vm, void *userData),
+		void (*workerFinish)(J9JavaVM *vm, void *workerData, void *userData),
+		void *userData,
+		omrthread_monitor_t reductionMutex)
+		: MM_ParallelTask(env, dispatcher)
+		, _javaVM(javaVM)
+		, _manager(manager)
+		, _memorySpace(memorySpace)
+		, _flags(flags)
+		, _func(func)
+		, _workerStart(workerStart)
+		, _workerFinish(workerFinish)
+		, _userData(userData)
+		, _reductionMutex(reductionMutex)
+		, _aborted(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 extern "C" {
 
 /* used by j9mm_iterate_all_objects */
@@ -97,6 +158,7 @@ typedef struct J9MM_CallbackDataHolderPrivate{
 	void *userData;
 	J9PortLibrary *portLibrary;
 	UDATA flags;
+	bool aborted; /**< Set if a region walk was aborted while walking with j9mm_iterator_flag_abort_region_only */
 } J9MM_CallbackDataHolderPrivate;
 
 
@@ -504,7 +566,12 @@ j9mm_iterate_all_objects(J9JavaVM *vm, J9PortLibrary *portLibrary, UDATA flags,
 	data.userData = userData;
 	data.portLibrary = portLibrary;
 	data.flags = flags;
-	return j9mm_iterate_heaps(vm, portLibrary, flags, &internalIterateHeaps, &data);
+	data.aborted = false;
+	jvmtiIterationControl returnCode = j9mm_iterate_heaps(vm, portLibrary, flags, &internalIterateHeaps, &data);
+	if (data.aborted) {
+		returnCode = JVMTI_ITERATION_ABORT;
+	}
+	return returnCode;
 }
 
 /* used by j9mm_iterate_all_objects */
@@ -526,7 +593,84 @@ static jvmtiIterationControl
 internalIterateRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData)
 {
 	J9MM_CallbackDataHolderPrivate *data = (J9MM_CallbackDataHolderPrivate *)userData;
-	return j9mm_iterate_region_objects(vm, data->portLibrary, region, data->flags, data->func, data->userData);
+	jvmtiIterationControl returnCode = j9mm_iterate_region_objects(vm, data->portLibrary, region, data->flags, data->func, data->userData);
+	if ((JVMTI_ITERATION_ABORT == returnCode) && (j9mm_iterator_flag_abort_region_only == (data->flags & j9mm_iterator_flag_abort_region_only))) {
+		/* move on to the next region, but remember the abort for the caller */
+		data->aborted = true;
+		returnCode = JVMTI_ITERATION_CONTINUE;
+	}
+	return returnCode;
+}
+
+/**
+ * Walk all objects for the given VM using the GC worker threads, call user provided function.
+ * Each region is walked by a single worker. Per-worker contexts are created by workerStart and
+ * reduced into userData by workerFinish, one worker at a time. If the reduction lock cannot be
+ * created the walk is done serially on the calling thread with a single worker context.
+ * An aborting call to func ends the whole walk unless j9mm_iterator_flag_abort_region_only is set,
+ * in which case only the walk of that region ends.
+ *
+ * @param vmThread The current thread, which must hold exclusive VM access
+ * @param flags The flags describing the walk (0 or any combination of j9mm_iterator_flag_include_holes and j9mm_iterator_flag_abort_region_only)
+ * @param func The function to call on each object descriptor, with the worker context.
+ * @param workerStart The function to call on each worker before walking, may be NULL.
+ * @param workerFinish The function to call on each worker after walking, may be NULL.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if any call to func aborted the walk, JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_parallel_iterate_all_objects(
+	J9VMThread *vmThread,
+	J9PortLibrary *portLibrary,
+	UDATA flags,
+	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *workerData),
+	void *(*workerStart)(J9JavaVM *vm, void *userData),
+	void (*workerFinish)(J9JavaVM *vm, void *workerData, void *userData),
+	void *userData)
+{
+	J9JavaVM *javaVM = vmThread->javaVM;
+	void *defaultMemorySpace = javaVM->defaultMemorySpace;
+	omrthread_monitor_t reductionMutex = NULL;
+	jvmtiIterationControl returnCode = JVMTI_ITERATION_CONTINUE;
+
+	Assert_MM_mustHaveExclusiveVMAccess(vmThread->omrVMThread);
+
+	if (NULL == defaultMemorySpace) {
+		return JVMTI_ITERATION_CONTINUE;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&reductionMutex, 0, "HeapIteratorAPI parallel walk")) {
+		void *workerData = (NULL == workerStart) ? NULL : workerStart(javaVM, userData);
+		returnCode = j9mm_iterate_all_objects(javaVM, portLibrary, flags, func, workerData);
+		if (NULL != workerFinish) {
+			workerFinish(javaVM, workerData, userData);
+		}
+		return returnCode;
+	}
+
+	if (j9mm_iterator_flag_regions_read_only != (flags & j9mm_iterator_flag_regions_read_only)) {
+		/* It is not a read-only request - make sure the heap is walkable (flush TLH's, secure heap integrity) */
+		javaVM->memoryManagerFunctions->j9gc_flush_caches_for_walk(javaVM);
+	}
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM->omrVM);
+	MM_MemorySpace *memorySpace = MM_MemorySpace::getMemorySpace(defaultMemorySpace);
+	MM_HeapRegionManager *manager = memorySpace->getHeap()->getHeapRegionManager();
+	MM_Dispatcher *dispatcher = extensions->dispatcher;
+
+	manager->lock();
+	HeapIteratorAPI_ParallelWalkTask walkTask(env, dispatcher, javaVM, manager, memorySpace, flags, func, workerStart, workerFinish, userData, reductionMutex);
+	dispatcher->run(env, &walkTask);
+	manager->unlock();
+
+	omrthread_monitor_destroy(reductionMutex);
+
+	if (walkTask.wasAborted()) {
+		returnCode = JVMTI_ITERATION_ABORT;
+	}
+
+	return returnCode;
 }
 
 /**
@@ -733,6 +877,36 @@ iterateRegions(
 	return returnCode;
 }
 
+void
+HeapIteratorAPI_ParallelWalkTask::run(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(_javaVM->omrVM);
+	void *workerData = (NULL == _workerStart) ? NULL : _workerStart(_javaVM, _userData);
+
+	/* Every worker must see the same sequence of work units, so keep claiming after an abort and just skip the walk */
+	bool abortRegionOnly = (j9mm_iterator_flag_abort_region_only == (_flags & j9mm_iterator_flag_abort_region_only));
+	GC_HeapRegionIterator regionIterator(_manager, _memorySpace);
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			if (abortRegionOnly || !_aborted) {
+				J9MM_IterateRegionDescriptorPrivate regionDescription;
+				regionDescription.type = j9mm_region_type_region;
+				initializeRegionDescriptor(extensions, &regionDescription.descriptor, region);
+				if (JVMTI_ITERATION_ABORT == iterateRegionObjects(_javaVM, &(regionDescription.descriptor), _flags, _func, workerData)) {
+					_aborted = true;
+				}
+			}
+		}
+	}
+
+	if (NULL != _workerFinish) {
+		omrthread_monitor_enter(_reductionMutex);
+		_workerFinish(_javaVM, workerData, _userData);
+		omrthread_monitor_exit(_reductionMutex);
+	}
+}
+
 static jvmtiIterationControl
 iterateRegionObjects(
 	J9JavaVM *vm,
@@ -237,46 +237,48 @@ GC_FinalizeListManager::popRequiredClassLoaderForForcedClassLoaderUnload()
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 GC_FinalizeJob *
-GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
+GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job, UDATA jobTypes)
 {
 	Assert_MM_true(J9_PUBLIC_FLAGS_VM_ACCESS == (vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS));
 	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
 	
-	{
+	if (0 != (jobTypes & FINALIZE_JOB_TYPE_REFERENCE)) {
 		j9object_t referenceObject = popReferenceObject();
 		if (NULL != referenceObject) {
 			job->type = FINALIZE_JOB_TYPE_REFERENCE;
 			job->reference = referenceObject;
+			_consumedJobCount += 1;
 
 			return job;
 		}
 	}
 
-	{
+	if (0 != (jobTypes & FINALIZE_JOB_TYPE_CLASSLOADER)) {
 		J9ClassLoader *loader = popClassLoader();
 		if (NULL != loader) {
 			job->type = FINALIZE_JOB_TYPE_CLASSLOADER;
 			job->classLoader = loader;
+			_consumedJobCount += 1;
 
 			return job;
 		}
 	}
 
-	{
+	if (0 != (jobTypes & FINALIZE_JOB_TYPE_OBJECT)) {
 		j9object_t defaultObject = popDefaultFinalizableObject();
 		if (NULL != defaultObject) {
 			job->type = FINALIZE_JOB_TYPE_OBJECT;
 			job->object = defaultObject;
+			_consumedJobCount += 1;
 
 			return job;
 		}
-	}
 
-	{
 		j9object_t systemObject = popSystemFinalizableObject();
 		if (NULL != systemObject) {
 			job->type = FINALIZE_JOB_TYPE_OBJECT;
 			job->object = systemObject;
+			_consumedJobCount += 1;
 
 			return job;
 		}
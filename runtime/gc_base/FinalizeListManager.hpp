@@ -47,6 +47,7 @@ typedef enum GC_FinalizeJobType {
 	FINALIZE_JOB_TYPE_REFERENCE = 2,
 	FINALIZE_JOB_TYPE_CLASSLOADER = 4
 } GC_FinalizeJobType;
+#define FINALIZE_JOB_TYPES_ALL (FINALIZE_JOB_TYPE_OBJECT | FINALIZE_JOB_TYPE_REFERENCE | FINALIZE_JOB_TYPE_CLASSLOADER)
 typedef struct GC_FinalizeJob {
 	GC_FinalizeJobType type;
 	union {
@@ -75,6 +76,7 @@ private:
     UDATA _referenceObjectCount; /** count of the reference object */
     J9ClassLoader *_classLoaders; /**< head of the linked list of unloaded classloaders which have open native libraries  */
     UDATA _classLoaderCount; /** count of the class loaders */
+    volatile UDATA _consumedJobCount; /**< count of the jobs handed out by consumeJob() since startup */
 protected:
 public:
     
@@ -137,6 +139,7 @@ public:
 	virtual UDATA getDefaultCount() {return _defaultFinalizableObjectCount;}
 	MMINLINE UDATA getClassloaderCount() {return _classLoaderCount;}
 	MMINLINE UDATA getReferenceCount() {return _referenceObjectCount;}
+	MMINLINE UDATA getConsumedJobCount() {return _consumedJobCount;}
 
 	static GC_FinalizeListManager	*newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -327,9 +330,13 @@ public:
 	 * 
 	 * @note Must be called while holding this class' _mutex
 	 *
+	 * @param vmThread[in] the thread which will process the job
+	 * @param job[out] storage for the job
+	 * @param jobTypes[in] mask of GC_FinalizeJobType values the caller is willing to process
+	 *
 	 * @return the next job or NULL
 	 */
-	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job);
+	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job, UDATA jobTypes = FINALIZE_JOB_TYPES_ALL);
 
 
 	/**
@@ -346,6 +353,7 @@ public:
 	    ,_referenceObjectCount(0)
 	    ,_classLoaders(NULL)
 	    ,_classLoaderCount(0)
+	    ,_consumedJobCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
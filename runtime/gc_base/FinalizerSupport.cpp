@@ -171,7 +171,29 @@ struct finalizeSlaveData {
 	IDATA wakeUp;
 };
 
+/**
+ * Shared state of the finalize helper threads. Helpers run alongside the slave thread during
+ * normal finalization cycles and drain reference and finalizable object jobs; class loader jobs,
+ * forced finalization and forced class loader unloading remain the responsibility of the slave.
+ */
+struct finalizeHelperPool {
+	omrthread_monitor_t monitor;
+	J9JavaVM *vm;
+	UDATA threadCount; /**< helpers which have been forked and have not yet exited */
+	UDATA pendingCount; /**< helpers which have been forked and have not yet attached */
+	UDATA activeCount; /**< helpers currently draining the finalize lists */
+	UDATA workRequests; /**< bumped by the master each time the helpers should drain the lists */
+	IDATA die;
+};
+
+#define FINALIZE_HELPER_IDLE_WAIT_MILLIS 1000
+
 static int J9THREAD_PROC FinalizeSlaveThread(void *arg);
+static int J9THREAD_PROC gpProtectedFinalizeHelperThread(void *entryArg);
+static struct finalizeHelperPool *finalizeHelperPoolStartup(J9JavaVM *vm, UDATA helperCount);
+static void finalizeHelperPoolWakeUp(struct finalizeHelperPool *helperPool);
+static void finalizeHelperPoolWaitForIdle(J9JavaVM *vm, struct finalizeHelperPool *helperPool);
+static void finalizeHelperPoolShutdown(J9JavaVM *vm, struct finalizeHelperPool *helperPool);
 IDATA FinalizeMasterRunFinalization(J9JavaVM * vm, omrthread_t * indirectSlaveThreadHandle, struct finalizeSlaveData **indirectSlaveData, IDATA finalizeCycleLimit, IDATA mode);
 static int J9THREAD_PROC FinalizeMasterThread(void *javaVM);
 static int  J9THREAD_PROC gpProtectedFinalizeSlaveThread(void *entryArg);
@@ -182,12 +204,14 @@ static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 	omrthread_t slaveThreadHandle;
 	int doneRunFinalizersOnExit, noCycleWait;
 	struct finalizeSlaveData *slaveData = NULL;
+	struct finalizeHelperPool *helperPool = NULL;
 	IDATA finalizeCycleInterval, finalizeCycleLimit, currentWaitTime, finalizableListUsed;
 	IDATA cycleIntervalWaitResult;
 	UDATA slaveMode, savedFinalizeMasterFlags;
 	GC_FinalizeListManager *finalizeListManager;
 	MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(vm->omrVM);
 	MM_Forge *forge = extensions->getForge();
+	UDATA helperCount = extensions->finalizeSlaveCount - 1;
 
 	/* explicitly set the name for master finalizer thread as it is not attached to VM */
 	omrthread_set_name(omrthread_self(), "Finalizer master");
@@ -265,6 +289,20 @@ static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 
 		savedFinalizeMasterFlags = vm->finalizeMasterFlags;
 
+		/* Let the helpers share the normal cycle with the slave */
+		if((0 != helperCount) && (0 != finalizableListUsed) && (FINALIZE_SLAVE_MODE_NORMAL == slaveMode)) {
+			if(NULL == helperPool) {
+				helperPool = finalizeHelperPoolStartup(vm, helperCount);
+				if(NULL == helperPool) {
+					/* carry on with the slave alone */
+					helperCount = 0;
+				}
+			}
+			if(NULL != helperPool) {
+				finalizeHelperPoolWakeUp(helperPool);
+			}
+		}
+
 		IDATA result = FinalizeMasterRunFinalization(vm, &slaveThreadHandle, &slaveData, finalizeCycleLimit, slaveMode);
 		if(result < 0) {
 			/* give up this run and hope next time will be better */
@@ -273,6 +311,11 @@ static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 			continue;
 		}
 
+		/* The slave may have run out of work while helpers are still finishing their last jobs */
+		if((NULL != helperPool) && (savedFinalizeMasterFlags & J9_FINALIZE_FLAGS_RUN_FINALIZATION)) {
+			finalizeHelperPoolWaitForIdle(vm, helperPool);
+		}
+
 		/* Determine whether the slave actually did finish it's work */
 		omrthread_monitor_enter(slaveData->monitor);
 		if(slaveData->finished) {
@@ -300,6 +343,11 @@ static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 		omrthread_monitor_exit(slaveData->monitor);
 	} while(!(vm->finalizeMasterFlags & J9_FINALIZE_FLAGS_SHUTDOWN));
 
+	if(NULL != helperPool) {
+		finalizeHelperPoolShutdown(vm, helperPool);
+		helperPool = NULL;
+	}
+
 	/* Check if finalizers should be run on exit */
 	if(vm->finalizeMasterFlags & J9_FINALIZE_FLAGS_RUN_FINALIZERS_ON_EXIT) {
 		doneRunFinalizersOnExit = 0;
@@ -460,6 +508,67 @@ process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jclass j9VMInte
 	}
 }
 
+/**
+ * Look up the Java methods used to run finalizers and enqueue references.
+ * Methods which cannot be found are left NULL.
+ */
+static void
+lookupFinalizeMethods(J9VMThread *env, jclass *j9VMInternalsClassOut, jmethodID *runFinalizeMIDOut, jmethodID *referenceEnqueueImplMIDOut)
+{
+	J9JavaVM *vm = env->javaVM;
+	jclass referenceClazz, j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+
+	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
+		/* Only look up finalization methods if the class library supports them */
+		j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
+		if (j9VMInternalsClass) {
+			j9VMInternalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(j9VMInternalsClass);
+			if (j9VMInternalsClass) {
+				runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(j9VMInternalsClass, "runFinalize", "(Ljava/lang/Object;)V");
+			}
+		}
+		if (!runFinalizeMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	
+		referenceClazz = ((JNIEnv *)env)->FindClass("java/lang/ref/Reference");
+		if (referenceClazz) {
+			referenceEnqueueImplMID  = ((JNIEnv *)env)->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
+		}
+		if (!referenceEnqueueImplMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	}
+
+	*j9VMInternalsClassOut = j9VMInternalsClass;
+	*runFinalizeMIDOut = runFinalizeMID;
+	*referenceEnqueueImplMIDOut = referenceEnqueueImplMID;
+}
+
+/**
+ * Called after each processed job to let Reference.waitForReferenceProcessing() callers know
+ * that progress has been made.
+ */
+static void
+notifyReferenceProcessingProgress(J9JavaVM *vm, GC_FinalizeListManager *finalizeListManager)
+{
+	if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		if (0 == finalizeListManager->getReferenceCount()) {
+			/* There is no more pending reference. */
+			vm->processReferenceActive = 0;
+		}
+		/*
+		 * Notify any waiters that progress has been made.
+		 * This improves latency for Reference.waitForReferenceProcessing() and try to
+		 * avoid the performance issue if there are many of pending references in the queue.
+		 */
+		omrthread_monitor_notify_all(vm->processReferenceMonitor);
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
 /**
  * Slave thread consumes jobs from Finalize List Manager and process them
  */
@@ -470,7 +579,7 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 	J9VMThread *env;
 	const GC_FinalizeJob *finalizeJob;
 	GC_FinalizeJob localJob;
-	jclass referenceClazz, j9VMInternalsClass = NULL;
+	jclass j9VMInternalsClass = NULL;
 	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
 	J9InternalVMFunctions* fns;
 	omrthread_monitor_t monitor;
@@ -512,27 +621,7 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 	/* Remember that the thread was gpProtected -- important for the JIT */
 	env->gpProtected = 1;
 
-	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
-		/* Only look up finalization methods if the class library supports them */
-		j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
-		if (j9VMInternalsClass) {
-			j9VMInternalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(j9VMInternalsClass);
-			if (j9VMInternalsClass) {
-				runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(j9VMInternalsClass, "runFinalize", "(Ljava/lang/Object;)V");
-			}
-		}
-		if (!runFinalizeMID) {
-			((JNIEnv *)env)->ExceptionClear();
-		}
-	
-		referenceClazz = ((JNIEnv *)env)->FindClass("java/lang/ref/Reference");
-		if (referenceClazz) {
-			referenceEnqueueImplMID  = ((JNIEnv *)env)->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
-		}
-		if (!referenceEnqueueImplMID) {
-			((JNIEnv *)env)->ExceptionClear();
-		}
-	}		
+	lookupFinalizeMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
 	slaveData->vmThread = env;
 
 	/* Notify that the slave has come on line (We should check the result from above) */
@@ -606,20 +695,7 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 			/* processing will release/acquire VM access */
 			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
 
-			if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				if (0 == finalizeListManager->getReferenceCount()) {
-					/* There is no more pending reference. */
-					vm->processReferenceActive = 0;
-				}
-				/*
-				 * Notify any waiters that progress has been made.
-				 * This improves latency for Reference.waitForReferenceProcessing() and try to
-				 * avoid the performance issue if there are many of pending references in the queue.
-				 */
-				omrthread_monitor_notify_all(vm->processReferenceMonitor);
-				omrthread_monitor_exit(vm->processReferenceMonitor);
-			}
+			notifyReferenceProcessingProgress(vm, finalizeListManager);
 
 			fns->jniResetStackReferences((JNIEnv *)env);
 
@@ -679,6 +755,268 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 	return 0;
 }
 
+/**
+ * Helper thread drains reference and finalizable object jobs from the Finalize List Manager
+ * whenever the master starts a normal finalization cycle.
+ */
+static int J9THREAD_PROC FinalizeHelperThread(void *arg)
+{
+	struct finalizeHelperPool *helperPool = (struct finalizeHelperPool *)arg;
+	jint result;
+	J9VMThread *env;
+	const GC_FinalizeJob *finalizeJob;
+	GC_FinalizeJob localJob;
+	jclass j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+	J9JavaVM *vm = helperPool->vm;
+	J9InternalVMFunctions* fns = vm->internalVMFunctions;
+	omrthread_monitor_t monitor = helperPool->monitor;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	GC_FinalizeListManager *finalizeListManager = extensions->finalizeListManager;
+	MM_Forge *forge = extensions->getForge();
+	JavaVMAttachArgs attachArgs;
+	UDATA workRequestsSeen;
+
+	attachArgs.version = JNI_VERSION_1_2;
+	attachArgs.name = (char *)"Finalizer helper";
+	attachArgs.group = (jobject)vm->systemThreadGroupRef;
+	result = ((JavaVM*)vm)->AttachCurrentThreadAsDaemon((void **)&env, (void*)&attachArgs);
+	if(result != JNI_OK) {
+		/* Failed to attach the thread - the pool carries on without this helper */
+		omrthread_monitor_enter(monitor);
+		helperPool->pendingCount -= 1;
+		helperPool->threadCount -= 1;
+		omrthread_monitor_notify_all(monitor);
+		omrthread_monitor_exit(monitor);
+		return 0;
+	}
+
+#if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
+	if( vm->javaOffloadSwitchOnWithReasonFunc != NULL ) {
+		(*vm->javaOffloadSwitchOnWithReasonFunc)((J9VMThread *)env, J9_JNI_OFFLOAD_SWITCH_FINALIZE_SLAVE_THREAD);
+		((J9VMThread *)env)->javaOffloadState = 1;
+	}
+#endif
+
+	fns->internalEnterVMFromJNI(env);
+	env->privateFlags |= (J9_PRIVATE_FLAGS_FINALIZE_SLAVE | J9_PRIVATE_FLAGS_USE_BOOTSTRAP_LOADER);
+	fns->internalReleaseVMAccess(env);
+
+	/* Remember that the thread was gpProtected -- important for the JIT */
+	env->gpProtected = 1;
+
+	lookupFinalizeMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
+
+	/* Notify the master that the helper has come on line */
+	omrthread_monitor_enter(monitor);
+	helperPool->pendingCount -= 1;
+	omrthread_monitor_notify_all(monitor);
+	workRequestsSeen = helperPool->workRequests;
+
+	while(FINALIZE_SLAVE_STAY_ALIVE == helperPool->die) {
+		if(workRequestsSeen == helperPool->workRequests) {
+			omrthread_monitor_wait(monitor);
+			continue;
+		}
+		workRequestsSeen = helperPool->workRequests;
+		helperPool->activeCount += 1;
+		omrthread_monitor_exit(monitor);
+
+		fns->internalEnterVMFromJNI(env);
+
+		do {
+			finalizeListManager->lock();
+			finalizeJob = finalizeListManager->consumeJob(env, &localJob, FINALIZE_JOB_TYPE_OBJECT | FINALIZE_JOB_TYPE_REFERENCE);
+			finalizeListManager->unlock();
+
+			if(NULL == finalizeJob) {
+				break;
+			}
+
+			/* processing will release/acquire VM access */
+			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+
+			notifyReferenceProcessingProgress(vm, finalizeListManager);
+
+			fns->jniResetStackReferences((JNIEnv *)env);
+		} while(FINALIZE_SLAVE_STAY_ALIVE == helperPool->die);
+
+		fns->internalReleaseVMAccess(env);
+
+		omrthread_monitor_enter(monitor);
+		helperPool->activeCount -= 1;
+		omrthread_monitor_notify_all(monitor);
+	}
+	omrthread_monitor_exit(monitor);
+
+	if (j9VMInternalsClass) {
+		((JNIEnv *)env)->DeleteGlobalRef(j9VMInternalsClass);
+	}
+
+	((JavaVM *)vm)->DetachCurrentThread();
+
+#if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
+	if( vm->javaOffloadSwitchOffNoEnvWithReasonFunc != NULL ) {
+		(*vm->javaOffloadSwitchOffNoEnvWithReasonFunc)(vm, omrthread_self(), J9_JNI_OFFLOAD_SWITCH_FINALIZE_SLAVE_THREAD);
+	}
+#endif
+
+	omrthread_monitor_enter(monitor);
+	helperPool->threadCount -= 1;
+	if((FINALIZE_SLAVE_ABANDONED == helperPool->die) && (0 == helperPool->threadCount)) {
+		/* The master has moved on - the last helper out cleans up */
+		omrthread_monitor_exit(monitor);
+		omrthread_monitor_destroy(monitor);
+		forge->free(helperPool);
+	} else {
+		omrthread_monitor_notify_all(monitor);
+		omrthread_exit(monitor);		/* exit the monitor, and terminate the thread */
+		/* NO EXECUTION GUARANTEE BEYOND THIS POINT */
+	}
+
+	/* NO EXECUTION GUARANTEE BEYOND THIS POINT */
+
+	return 0;
+}
+
+/**
+ * Fork the finalize helper threads and wait for them to attach.
+ *
+ * Preconditions:
+ * 	holds finalizeMasterMonitor
+ * Postconditions:
+ * 	holds finalizeMasterMonitor
+ *
+ * @return the helper pool, or NULL if no helper could be started
+ */
+static struct finalizeHelperPool *
+finalizeHelperPoolStartup(J9JavaVM *vm, UDATA helperCount)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	MM_Forge *forge = extensions->getForge();
+	struct finalizeHelperPool *helperPool = NULL;
+
+	helperPool = (struct finalizeHelperPool *)forge->allocate(sizeof(struct finalizeHelperPool), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+	if (NULL == helperPool) {
+		return NULL;
+	}
+	helperPool->vm = vm;
+	helperPool->threadCount = 0;
+	helperPool->pendingCount = 0;
+	helperPool->activeCount = 0;
+	helperPool->workRequests = 0;
+	helperPool->die = FINALIZE_SLAVE_STAY_ALIVE;
+
+	if (0 != omrthread_monitor_init_with_name(&(helperPool->monitor), 0, "Finalizer helper pool")) {
+		forge->free(helperPool);
+		return NULL;
+	}
+
+	omrthread_monitor_exit(vm->finalizeMasterMonitor);
+	omrthread_monitor_enter(helperPool->monitor);
+
+	for (UDATA i = 0; i < helperCount; i++) {
+		IDATA result = vm->internalVMFunctions->createThreadWithCategory(
+							NULL,
+							vm->defaultOSStackSize,
+							extensions->finalizeSlavePriority,
+							0,
+							&gpProtectedFinalizeHelperThread,
+							helperPool,
+							J9THREAD_CATEGORY_APPLICATION_THREAD);
+		if (0 != result) {
+			break;
+		}
+		helperPool->threadCount += 1;
+		helperPool->pendingCount += 1;
+	}
+
+	while (0 != helperPool->pendingCount) {
+		omrthread_monitor_wait(helperPool->monitor);
+	}
+
+	if (0 == helperPool->threadCount) {
+		omrthread_monitor_exit(helperPool->monitor);
+		omrthread_monitor_destroy(helperPool->monitor);
+		forge->free(helperPool);
+		helperPool = NULL;
+	} else {
+		omrthread_monitor_exit(helperPool->monitor);
+	}
+
+	omrthread_monitor_enter(vm->finalizeMasterMonitor);
+
+	return helperPool;
+}
+
+/**
+ * Ask every idle helper to drain the finalize lists.
+ */
+static void
+finalizeHelperPoolWakeUp(struct finalizeHelperPool *helperPool)
+{
+	omrthread_monitor_enter(helperPool->monitor);
+	helperPool->workRequests += 1;
+	omrthread_monitor_notify_all(helperPool->monitor);
+	omrthread_monitor_exit(helperPool->monitor);
+}
+
+/**
+ * Give the helpers a bounded amount of time to finish the jobs they are running so that
+ * a pending System.runFinalization() request covers them.
+ *
+ * Preconditions:
+ * 	holds finalizeMasterMonitor
+ * Postconditions:
+ * 	holds finalizeMasterMonitor
+ */
+static void
+finalizeHelperPoolWaitForIdle(J9JavaVM *vm, struct finalizeHelperPool *helperPool)
+{
+	omrthread_monitor_exit(vm->finalizeMasterMonitor);
+	omrthread_monitor_enter(helperPool->monitor);
+	while (0 != helperPool->activeCount) {
+		if (J9THREAD_TIMED_OUT == omrthread_monitor_wait_timed(helperPool->monitor, FINALIZE_HELPER_IDLE_WAIT_MILLIS, 0)) {
+			break;
+		}
+	}
+	omrthread_monitor_exit(helperPool->monitor);
+	omrthread_monitor_enter(vm->finalizeMasterMonitor);
+}
+
+/**
+ * Tell the helpers to die and wait for the idle ones to exit. Helpers still running a
+ * finalizer are abandoned, and the last of them to exit frees the pool.
+ *
+ * Preconditions:
+ * 	holds finalizeMasterMonitor
+ * Postconditions:
+ * 	holds finalizeMasterMonitor
+ */
+static void
+finalizeHelperPoolShutdown(J9JavaVM *vm, struct finalizeHelperPool *helperPool)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(vm)->getForge();
+
+	omrthread_monitor_exit(vm->finalizeMasterMonitor);
+	omrthread_monitor_enter(helperPool->monitor);
+	helperPool->die = FINALIZE_SLAVE_SHOULD_DIE;
+	omrthread_monitor_notify_all(helperPool->monitor);
+	while ((0 != helperPool->threadCount) && (helperPool->threadCount != helperPool->activeCount)) {
+		omrthread_monitor_wait(helperPool->monitor);
+	}
+
+	if (0 == helperPool->threadCount) {
+		omrthread_monitor_exit(helperPool->monitor);
+		omrthread_monitor_destroy(helperPool->monitor);
+		forge->free(helperPool);
+	} else {
+		helperPool->die = FINALIZE_SLAVE_ABANDONED;
+		omrthread_monitor_exit(helperPool->monitor);
+	}
+	omrthread_monitor_enter(vm->finalizeMasterMonitor);
+}
+
 /*
  * Preconditions:
  * 	holds finalizeMasterMonitor
@@ -822,6 +1160,27 @@ gpProtectedFinalizeSlaveThread(void *entryArg)
 	return 0;
 }
 
+static UDATA
+FinalizeHelperThreadGlue(J9PortLibrary* portLib, void* userData)
+{
+	return FinalizeHelperThread(userData);
+}
+
+static int J9THREAD_PROC
+gpProtectedFinalizeHelperThread(void *entryArg)
+{
+	struct finalizeHelperPool *helperPool = (struct finalizeHelperPool *) entryArg;
+	PORT_ACCESS_FROM_PORT(helperPool->vm->portLibrary);
+	UDATA rc;
+
+	j9sig_protect(FinalizeHelperThreadGlue, helperPool,
+		helperPool->vm->internalVMFunctions->structuredSignalHandlerVM, helperPool->vm,
+		J9PORT_SIG_FLAG_SIGALLSYNC | J9PORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+
+	return 0;
+}
+
 void
 j9gc_finalizer_completeFinalizersOnExit(J9VMThread* vmThread)
 {
@@ -37,6 +37,8 @@
 #define J9_FINALIZE_FLAGS_ACTIVE 262144
 #define J9_FINALIZE_FLAGS_MASTER_WORK_REQUEST 99
 
+#define J9_FINALIZE_SLAVE_COUNT_MAX 64
+
 #define J9_FINALIZE_JOB_TYPE_CONTAINS_OBJECT 1
 #define J9_FINALIZE_JOB_TYPE_FINALIZATION 1
 #define J9_FINALIZE_JOB_TYPE_FREE_CLASS_LOADER 2
@@ -140,6 +140,7 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 	UDATA finalizeMasterPriority; /**< cmd line option to set finalize master thread priority */
 	UDATA finalizeSlavePriority; /**< cmd line option to set finalize slave thread priority */
+	UDATA finalizeSlaveCount; /**< cmd line option to set the number of threads running finalizers (slave plus helpers) */
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_ClassLoaderManager* classLoaderManager; /**< Pointer to the gc's classloader manager to process classloaders/classes */
@@ -186,6 +187,10 @@ public:
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 
+#if defined(J9VM_GC_VLHGC)
+	UDATA tarokPGCPauseTargetMillis; /**< Upper bound on the predicted copy-forward time of a PGC, used to cap the Eden size (0 disables the cap) */
+#endif /* defined(J9VM_GC_VLHGC) */
+
 protected:
 private:
 protected:
@@ -287,6 +292,7 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeMasterPriority(J9THREAD_PRIORITY_NORMAL)
 		, finalizeSlavePriority(J9THREAD_PRIORITY_NORMAL)
+		, finalizeSlaveCount(1)
 #endif /* J9VM_GC_FINALIZATION */
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 		, deadClassLoaderCacheSize(1024 * 1024) /* default is one MiB */
@@ -304,6 +310,9 @@ public:
 #endif
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
+#if defined(J9VM_GC_VLHGC)
+		, tarokPGCPauseTargetMillis(0)
+#endif /* defined(J9VM_GC_VLHGC) */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -40,12 +40,14 @@ extern "C" {
 typedef struct stringTableUTF8Query {
 	U_8 *utf8Data;
 	UDATA utf8Length;
+	U_32 unicodeLength; /* number of UTF16 characters the UTF8 data decodes to */
 	U_32 hash;
 } stringTableUTF8Query;
 
 static UDATA stringHashFn (void *key, void *userData);
 static UDATA stringHashEqualFn (void *leftKey, void *rightKey, void *userData);
 static IDATA stringComparatorFn(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struct J9AVLTreeNode *rightNode);
+static U_32 getCachedStringHash(J9JavaVM *javaVM, j9object_t string);
 static UDATA getUnicodeLength (U_8 *data, UDATA length, bool *isCompressable);
 static bool isUnicodeCompressable(U_16 *data, UDATA length);
 static j9object_t setupCharArray(J9VMThread *vmThread, j9object_t sourceString, j9object_t newString);
@@ -163,7 +165,22 @@ MM_StringTable::hashAtUTF8(UDATA tableIndex, U_8 *utf8Data, UDATA utf8Length, U_
 
 	query.utf8Data = utf8Data;
 	query.utf8Length = utf8Length;
+	query.unicodeLength = 0;
 	query.hash = hash;
+
+	/* The comparator orders strings by hash, then length, then characters, so the decoded length is needed up front */
+	while (utf8Length != 0) {
+		U_16 unicode = 0;
+		U_32 consumed = decodeUTF8CharN(utf8Data, &unicode, utf8Length);
+		if (0 == consumed) {
+			/* malformed data; the character comparison will fail at this point */
+			break;
+		}
+		utf8Data += consumed;
+		utf8Length -= consumed;
+		query.unicodeLength += 1;
+	}
+
 	ptr = &query;
 	ptr = (void *) ((UDATA) ptr | TYPE_UTF8); /* Least significant bit indicates that this is a pointer to a stringTableUTF8Query */
 	return hashAt(tableIndex, (j9object_t)ptr);
@@ -219,6 +236,7 @@ stringComparatorFn(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struc
 	UDATA stu8Ptr = 0;
 	IDATA rc = 0;
 	bool rightCompressed = false;
+	U_32 rightHash = 0;
 
 	/* leftNode data may be a pointer to a low-tagged pointer to a struct (it is the node used for hashTableFind) */
 	stu8Ptr = *((UDATA*) (leftNode+1)); 
@@ -238,7 +256,11 @@ stringComparatorFn(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struc
 	rightLength = J9VMJAVALANGSTRING_LENGTH_VM(javaVM, right_s);
 	right_p = J9VMJAVALANGSTRING_VALUE_VM(javaVM, right_s);
 	rightCompressed = IS_STRING_COMPRESSED_VM(javaVM, right_s);
+	rightHash = getCachedStringHash(javaVM, right_s);
 
+	/* Strings are ordered by hash first, so that probing a bucket only decodes the
+	 * characters of strings which are likely to be equal.
+	 */
 	if (stu8Ptr & TYPE_UTF8) {
 		stringTableUTF8Query *leftUTF8 = (stringTableUTF8Query*) (stu8Ptr & ~TYPE_UTF8);
 		U_32 leftLength = (U_32) leftUTF8->utf8Length;
@@ -246,6 +268,16 @@ stringComparatorFn(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struc
 		U_32 left_i = 0;
 		U_32 i = 0;
 
+		if (leftUTF8->hash != rightHash) {
+			rc = (leftUTF8->hash < rightHash) ? -1 : 1;
+			goto done;
+		}
+		/* must match the String branch below, otherwise UTF8 lookups can descend into the wrong subtree */
+		if (leftUTF8->unicodeLength != rightLength) {
+			rc = (IDATA)leftUTF8->unicodeLength - (IDATA)rightLength;
+			goto done;
+		}
+
 		for (i = 0; i < rightLength; i++) {
 			U_16 leftChar = 0;
 			U_16 rightChar = 0;
@@ -296,6 +328,7 @@ stringComparatorFn(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struc
 		U_32 left_i = 0;
 		U_32 i = 0;
 		bool leftCompressed = false;
+		U_32 leftHash = 0;
 
 		left_s = *(j9object_t *)(leftNode+1);
 
@@ -311,8 +344,18 @@ stringComparatorFn(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struc
 		leftLength = J9VMJAVALANGSTRING_LENGTH_VM(javaVM, left_s);
 		left_p = J9VMJAVALANGSTRING_VALUE_VM(javaVM, left_s);
 		leftCompressed = IS_STRING_COMPRESSED_VM(javaVM, left_s);
+		leftHash = getCachedStringHash(javaVM, left_s);
+
+		if (leftHash != rightHash) {
+			rc = (leftHash < rightHash) ? -1 : 1;
+			goto done;
+		}
+		if (leftLength != rightLength) {
+			rc = (IDATA)leftLength - (IDATA)rightLength;
+			goto done;
+		}
 
-		for (i = 0; i < OMR_MIN(leftLength, rightLength); i++) {
+		for (i = 0; i < leftLength; i++) {
 			U_16 leftChar = 0;
 			U_16 rightChar = 0;
 			
@@ -335,10 +378,6 @@ stringComparatorFn(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struc
 				goto done;
 			}
 		}
-		if (leftLength != rightLength) {
-			rc = (IDATA)leftLength - (IDATA)rightLength;
-			goto done;
-		}
 
 		if (isMetronome) {
 #if defined(J9VM_GC_REALTIME) 
@@ -505,6 +544,23 @@ computeJavaHashForExpandedString(J9JavaVM *javaVM, j9object_t s)
 	return hash;
 }
 
+/**
+ * Return the hash of a String in the table without storing it. Strings are hashed by
+ * stringHashFn() when they are added, so the cached value is almost always present.
+ * @param javaVM pointer to the J9JavaVM
+ * @param string the String object
+ * @return the Java hash code of the string
+ */
+static U_32
+getCachedStringHash(J9JavaVM *javaVM, j9object_t string)
+{
+	U_32 hash = (U_32)J9VMJAVALANGSTRING_HASHCODE_VM(javaVM, string);
+	if (0 == hash) {
+		hash = computeJavaHashForExpandedString(javaVM, string);
+	}
+	return hash;
+}
+
 /**
  * stringHashFn
  * Hash a string stored either as a UTF8 string or String object
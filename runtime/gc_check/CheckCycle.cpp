@@ -115,6 +115,8 @@ GC_CheckCycle::printHelp(J9PortLibrary *portLib)
 
 	j9tty_printf(PORTLIB, "  abort\n");
 	j9tty_printf(PORTLIB, "  noabort\n");
+	j9tty_printf(PORTLIB, "  parallel\n");
+	j9tty_printf(PORTLIB, "  noparallel\n");
 	j9tty_printf(PORTLIB, "  dumpstack\n");
 	j9tty_printf(PORTLIB, "  nodumpstack\n");
 	j9tty_printf(PORTLIB, "  interval=X\n");
@@ -305,6 +307,16 @@ top:
 						}
 #endif /* J9VM_GC_MODRON_SCAVENGER  || defined(J9VM_GC_VLHGC) */
 
+						if (try_scan(&scan_start, "parallel")) {
+							miscFlags |= J9MODRON_GCCHK_MISC_PARALLEL;
+							continue;
+						}
+
+						if (try_scan(&scan_start, "noparallel")) {
+							miscFlags &= ~J9MODRON_GCCHK_MISC_PARALLEL;
+							continue;
+						}
+
 						if (try_scan(&scan_start, "abort")) {
 							miscFlags |= J9MODRON_GCCHK_MISC_ABORT;
 							continue;
@@ -32,6 +32,7 @@
 #include "j9.h"
 #include "j9cfg.h"
 
+#include "AtomicOperationsAPI.hpp"
 #include "Base.hpp"
 #include "CheckBase.hpp"
 
@@ -56,7 +57,7 @@ private:
 	UDATA _miscFlags;
 	GCCheckInvokedBy _invokedBy; /**< What stage of GC invoked the check */
 	UDATA _manualCheckInvocation; /**< Allow user to identify which installed GCCheck triggered message */
-	UDATA _errorCount; /**< Number of errors encountered  */
+	volatile UDATA _errorCount; /**< Number of errors encountered  */
 	
 	GC_Check *_checks; /**< Pointer to head of linked list of checks to run in this cycle */
 	
@@ -85,7 +86,11 @@ public:
 	GCCheckInvokedBy getInvoker() { return _invokedBy; };
 	UDATA getManualCheckNumber() { return _manualCheckInvocation; };
 	
-	UDATA nextErrorCount() { return ++_errorCount; };
+	/* Errors may be reported concurrently by the workers of a parallel check */
+	UDATA nextErrorCount() { return MM_AtomicOperations::add(&_errorCount, 1); };
+	UDATA getErrorCount() { return _errorCount; };
+	/* Used to discard the errors numbered by an abandoned parallel check */
+	void setErrorCount(UDATA errorCount) { _errorCount = errorCount; };
 	
 	/**
 	 * Run the checks
@@ -46,6 +46,7 @@
 #include "CheckCycle.hpp"
 #include "CheckError.hpp"
 #include "CheckReporter.hpp"
+#include "CheckReporterBuffered.hpp"
 #include "CheckReporterTTY.hpp"
 #include "ClassModel.hpp"
 #include "GCExtensions.hpp"
@@ -303,8 +304,7 @@ GC_CheckEngine::checkJ9ObjectPointer(J9JavaVM *javaVM, J9Object *objectPtr, J9Ob
 				*newObjectPtr = scavengerForwardedHeader.getForwardedObject();
 				
 				if (_cycle->getMiscFlags() & J9MODRON_GCCHK_VERBOSE) {
-					PORT_ACCESS_FROM_PORT(_portLibrary);
-					j9tty_printf(PORTLIB, "  <gc check: found forwarded pointer %p -> %p>\n", objectPtr, *newObjectPtr);	
+					_reporter->reportForwardedObject(objectPtr, *newObjectPtr);
 				}
 				
 				objectPtr = *newObjectPtr;
@@ -1109,8 +1109,7 @@ GC_CheckEngine::checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *
 		/* check Ownable Synchronizer Object consistency */
 		if ((OBJECT_HEADER_SHAPE_MIXED == J9GC_CLASS_SHAPE(clazz)) && (0 != (J9CLASS_FLAGS(clazz) & J9_JAVA_CLASS_OWNABLE_SYNCHRONIZER))) {
 			if (NULL == extensions->accessBarrier->isObjectInOwnableSynchronizerList(objectDesc->object)) {
-				PORT_ACCESS_FROM_PORT(_portLibrary);
-				j9tty_printf(PORTLIB, "  <gc check: found Ownable SynchronizerObject %p is not on the list >\n", objectDesc->object);
+				_reporter->reportOwnableSynchronizerNotOnList(objectDesc->object);
 			} else {
 				_ownableSynchronizerObjectCountOnHeap += 1;
 			}
@@ -1435,6 +1434,49 @@ GC_CheckEngine::kill()
 	forge->free(this);
 }
 
+GC_CheckEngine *
+GC_CheckEngine::newWorkerInstance()
+{
+	GC_CheckEngine *worker = NULL;
+	GC_CheckReporterBuffered *reporter = GC_CheckReporterBuffered::newInstance(_javaVM, _reporter);
+
+	if (NULL != reporter) {
+		worker = newInstance(_javaVM, reporter);
+		if (NULL == worker) {
+			reporter->kill();
+		} else {
+			worker->_cycle = _cycle;
+			worker->_currentCheck = _currentCheck;
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+			worker->_scavengerBackout = _scavengerBackout;
+			worker->_rsOverflowState = _rsOverflowState;
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+			/* the count found by the worker is added to the count of this engine when the worker is merged */
+			worker->_ownableSynchronizerObjectCountOnHeap = 0;
+		}
+	}
+	return worker;
+}
+
+void
+GC_CheckEngine::mergeWorkerInstance(GC_CheckEngine *worker)
+{
+	((GC_CheckReporterBuffered *)worker->_reporter)->flush();
+	_ownableSynchronizerObjectCountOnHeap += worker->_ownableSynchronizerObjectCountOnHeap;
+}
+
+UDATA
+GC_CheckEngine::getErrorCount()
+{
+	return _cycle->getErrorCount();
+}
+
+void
+GC_CheckEngine::restoreErrorCount(UDATA errorCount)
+{
+	_cycle->setErrorCount(errorCount);
+}
+
 /**
  * Determine whether or not the a verbose stack dump should always be displayed.
  *
@@ -1450,6 +1492,27 @@ GC_CheckEngine::isStackDumpAlwaysDisplayed()
 	return (J9MODRON_GCCHK_MISC_ALWAYS_DUMP_STACK == (_cycle->getMiscFlags() & J9MODRON_GCCHK_MISC_ALWAYS_DUMP_STACK));
 }
 
+/**
+ * Determine whether or not the current check may be split across the GC worker threads.
+ * Only checks invoked from within a GC, where the heap is held exclusively and the
+ * dispatcher is idle, are run in parallel.
+ *
+ * @return true if the parallel option was given and the check was invoked by the GC.
+ * @return false otherwise.
+ */
+bool
+GC_CheckEngine::isParallelCheckEnabled()
+{
+	if (NULL == _cycle) {
+		return false;
+	}
+	if (J9MODRON_GCCHK_MISC_PARALLEL != (_cycle->getMiscFlags() & J9MODRON_GCCHK_MISC_PARALLEL)) {
+		return false;
+	}
+	GCCheckInvokedBy invoker = _cycle->getInvoker();
+	return (invocation_unknown != invoker) && (invocation_manual != invoker) && (invocation_debugger != invoker);
+}
+
 /**
  * Copy the information from one regionDescription to the other.
  * @param from - the source region
@@ -158,10 +158,38 @@ public:
 	static GC_CheckEngine *newInstance(J9JavaVM *javaVM, GC_CheckReporter *reporter);
 	void kill();
 
+	/**
+	 * Create an engine for one worker of a parallel check.
+	 * The worker continues the current check of this engine, with its own caches and a
+	 * reporter which buffers its errors until mergeWorkerInstance() is called.
+	 * @return the worker engine, or NULL if it could not be allocated
+	 */
+	GC_CheckEngine *newWorkerInstance();
+
+	/**
+	 * Report the errors buffered by a worker created with newWorkerInstance() and
+	 * add its counts to this engine.  Only one worker may be merged at a time.
+	 * @param worker the worker engine, which is still owned by the caller
+	 */
+	void mergeWorkerInstance(GC_CheckEngine *worker);
+
+	/**
+	 * @return the number of errors numbered so far in the current check cycle
+	 */
+	UDATA getErrorCount();
+
+	/**
+	 * Forget the errors numbered since getErrorCount() returned errorCount, such as those
+	 * found by workers whose reports were discarded.
+	 * @param errorCount a value returned by getErrorCount()
+	 */
+	void restoreErrorCount(UDATA errorCount);
+
 	void startCheckCycle(J9JavaVM *javaVM, GC_CheckCycle *checkCycle);
 	void endCheckCycle(J9JavaVM *javaVM);
 	void startNewCheck(GC_Check *check);	
 	bool isStackDumpAlwaysDisplayed();
+	bool isParallelCheckEnabled();
 	void copyRegionDescription(J9MM_IterateRegionDescriptor* from, J9MM_IterateRegionDescriptor* to);
 	void clearRegionDescription(J9MM_IterateRegionDescriptor* toClear);
 	
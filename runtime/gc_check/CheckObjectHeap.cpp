@@ -37,6 +37,26 @@ typedef struct ObjectIteratorCallbackUserData {
 	J9MM_IterateRegionDescriptor* regionDesc; /* Temp - used internally by iterator functions */
 } ObjectIteratorCallbackUserData;
 
+/**
+ * Private struct used as the user data of a parallel walk of the heap.
+ */
+typedef struct ParallelObjectIteratorUserData {
+	GC_CheckEngine* engine; /* Input */
+	bool workerFailed; /* Output - set if a worker engine could not be allocated */
+	struct ParallelObjectIteratorWorkerData* finishedWorkers; /* Output - the workers which completed, in the order they finished */
+	struct ParallelObjectIteratorWorkerData** finishedWorkersTail; /* Temp - used to append to finishedWorkers */
+} ParallelObjectIteratorUserData;
+
+/**
+ * Private struct holding the state of one worker of a parallel walk of the heap.
+ */
+typedef struct ParallelObjectIteratorWorkerData {
+	GC_CheckEngine* engine; /* The engine of this worker */
+	J9MM_IterateRegionDescriptor regionDesc; /* The region of the last object visited */
+	bool regionValid; /* Whether regionDesc has been set */
+	struct ParallelObjectIteratorWorkerData* next; /* The next worker in ParallelObjectIteratorUserData::finishedWorkers */
+} ParallelObjectIteratorWorkerData;
+
 /**
  * Iterator callbacks, these are chained to eventually get to objects and their regions.
  */
@@ -44,6 +64,9 @@ static jvmtiIterationControl check_heapIteratorCallback(J9JavaVM* vm, J9MM_Itera
 static jvmtiIterationControl check_spaceIteratorCallback(J9JavaVM* vm, J9MM_IterateSpaceDescriptor* spaceDesc, void* userData);
 static jvmtiIterationControl check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData);
 static jvmtiIterationControl check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData);
+static void *check_parallelWorkerStart(J9JavaVM* vm, void* userData);
+static jvmtiIterationControl check_parallelObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* workerData);
+static void check_parallelWorkerFinish(J9JavaVM* vm, void* workerData, void* userData);
 
 GC_Check *
 GC_CheckObjectHeap::newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine)
@@ -67,6 +90,41 @@ GC_CheckObjectHeap::kill()
 void
 GC_CheckObjectHeap::check()
 {
+	if (_engine->isParallelCheckEnabled()) {
+		/* Split the regions of the heap across the GC worker threads */
+		ParallelObjectIteratorUserData parallelUserData;
+		parallelUserData.engine = _engine;
+		parallelUserData.workerFailed = false;
+		parallelUserData.finishedWorkers = NULL;
+		parallelUserData.finishedWorkersTail = &parallelUserData.finishedWorkers;
+		UDATA errorCount = _engine->getErrorCount();
+		J9VMThread *vmThread = _javaVM->internalVMFunctions->currentVMThread(_javaVM);
+		/* like the serial walk, an error only ends the check of the region it was found in */
+		_javaVM->memoryManagerFunctions->j9mm_parallel_iterate_all_objects(vmThread, _portLibrary, j9mm_iterator_flag_include_holes | j9mm_iterator_flag_abort_region_only,
+			check_parallelObjectIteratorCallback, check_parallelWorkerStart, check_parallelWorkerFinish, &parallelUserData);
+
+		/* Only report what the workers found if the whole heap was walked; otherwise the serial walk below reports it again */
+		MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+		ParallelObjectIteratorWorkerData *workerData = parallelUserData.finishedWorkers;
+		while (NULL != workerData) {
+			ParallelObjectIteratorWorkerData *nextWorkerData = workerData->next;
+			if (!parallelUserData.workerFailed) {
+				_engine->mergeWorkerInstance(workerData->engine);
+			}
+			workerData->engine->kill();
+			forge->free(workerData);
+			workerData = nextWorkerData;
+		}
+		if (!parallelUserData.workerFailed) {
+			return;
+		}
+		/* number the errors of the serial walk as if the parallel walk had not happened */
+		_engine->restoreErrorCount(errorCount);
+		PORT_ACCESS_FROM_PORT(_portLibrary);
+		j9tty_printf(PORTLIB, "  <gc check: unable to allocate a parallel worker, checking the heap serially>\n");
+		_engine->startNewCheck(this);
+	}
+
 	/* Check by using the HeapIteratorAPI */
 	ObjectIteratorCallbackUserData userData;
 	userData.engine = _engine;
@@ -118,3 +176,66 @@ check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectD
 	castUserData->engine->pushPreviousObject(objectDesc->object);
 	return JVMTI_ITERATION_CONTINUE;
 }
+
+static void *
+check_parallelWorkerStart(J9JavaVM* vm, void* userData)
+{
+	ParallelObjectIteratorUserData* castUserData = (ParallelObjectIteratorUserData*)userData;
+	MM_Forge *forge = MM_GCExtensions::getExtensions(vm)->getForge();
+
+	ParallelObjectIteratorWorkerData* workerData = (ParallelObjectIteratorWorkerData*)forge->allocate(sizeof(ParallelObjectIteratorWorkerData), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != workerData) {
+		workerData->engine = castUserData->engine->newWorkerInstance();
+		workerData->regionValid = false;
+		workerData->next = NULL;
+		if (NULL == workerData->engine) {
+			forge->free(workerData);
+			workerData = NULL;
+		}
+	}
+	return workerData;
+}
+
+static jvmtiIterationControl
+check_parallelObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* workerData)
+{
+	ParallelObjectIteratorWorkerData* castWorkerData = (ParallelObjectIteratorWorkerData*)workerData;
+	if (NULL == castWorkerData) {
+		/* this worker could not be set up; the heap will be checked again serially */
+		return JVMTI_ITERATION_ABORT;
+	}
+
+	/* objects are visited a region at a time, so the region only needs to be found again when the walk moves on */
+	J9MM_IterateRegionDescriptor* regionDesc = &castWorkerData->regionDesc;
+	if (!castWorkerData->regionValid
+		|| ((UDATA)objectDesc->object < (UDATA)regionDesc->regionStart)
+		|| ((UDATA)objectDesc->object >= ((UDATA)regionDesc->regionStart + regionDesc->regionSize))
+	) {
+		castWorkerData->regionValid = (0 != vm->memoryManagerFunctions->j9mm_find_region_for_pointer(vm, objectDesc->object, regionDesc));
+		if (!castWorkerData->regionValid) {
+			return JVMTI_ITERATION_ABORT;
+		}
+	}
+
+	if (castWorkerData->engine->checkObjectHeap(vm, objectDesc, regionDesc) != J9MODRON_SLOT_ITERATOR_OK) {
+		return JVMTI_ITERATION_ABORT;
+	}
+
+	castWorkerData->engine->pushPreviousObject(objectDesc->object);
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static void
+check_parallelWorkerFinish(J9JavaVM* vm, void* workerData, void* userData)
+{
+	ParallelObjectIteratorUserData* castUserData = (ParallelObjectIteratorUserData*)userData;
+	ParallelObjectIteratorWorkerData* castWorkerData = (ParallelObjectIteratorWorkerData*)workerData;
+
+	/* workers finish one at a time, so the list needs no locking; its reports are merged once every worker has finished */
+	if (NULL == castWorkerData) {
+		castUserData->workerFailed = true;
+	} else {
+		*castUserData->finishedWorkersTail = castWorkerData;
+		castUserData->finishedWorkersTail = &castWorkerData->next;
+	}
+}
@@ -44,3 +44,17 @@ GC_CheckReporter::reportGenericType(GC_CheckError *error, GC_CheckElement refere
 			break;
 	}	
 }
+
+void
+GC_CheckReporter::reportForwardedObject(J9Object *objectPtr, J9Object *newObjectPtr)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	j9tty_printf(PORTLIB, "  <gc check: found forwarded pointer %p -> %p>\n", objectPtr, newObjectPtr);
+}
+
+void
+GC_CheckReporter::reportOwnableSynchronizerNotOnList(J9Object *objectPtr)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	j9tty_printf(PORTLIB, "  <gc check: found Ownable SynchronizerObject %p is not on the list >\n", objectPtr);
+}
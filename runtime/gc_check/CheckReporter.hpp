@@ -105,7 +105,18 @@ public:
 		GC_CheckElement previousObjectPtr2, 
 		GC_CheckElement previousObjectPtr3) = 0;
 
+	/**
+	 * Report that a forwarded pointer was followed while checking a heap object.
+	 */
+	virtual void reportForwardedObject(J9Object *objectPtr, J9Object *newObjectPtr);
+
+	/**
+	 * Report an ownable synchronizer object which is not on an ownable synchronizer list.
+	 */
+	virtual void reportOwnableSynchronizerNotOnList(J9Object *objectPtr);
+
 	void setMaxErrorsToReport(UDATA count) { _maxErrorsToReport = count; }
+	UDATA getMaxErrorsToReport() { return _maxErrorsToReport; }
 	bool shouldReport(GC_CheckError *error) { 
 		return (_maxErrorsToReport == 0) || (error->_errorNumber <= _maxErrorsToReport);
 	}
@@ -0,0 +1,202 @@
+
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#include "CheckReporterBuffered.hpp"
+
+#include "Base.hpp"
+#include "CheckBase.hpp"
+#include "CheckError.hpp"
+#include "GCExtensions.hpp"
+
+/**
+ * Create a new instance of the buffered reporter, replaying into the specified reporter.
+ */
+GC_CheckReporterBuffered *
+GC_CheckReporterBuffered::newInstance(J9JavaVM *javaVM, GC_CheckReporter *target)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(javaVM)->getForge();
+
+	GC_CheckReporterBuffered *reporter = (GC_CheckReporterBuffered *)forge->allocate(sizeof(GC_CheckReporterBuffered), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != reporter) {
+		reporter = new(reporter) GC_CheckReporterBuffered(javaVM, target);
+		if (!reporter->initialize()) {
+			reporter->kill();
+			reporter = NULL;
+		}
+	}
+	return reporter;
+}
+
+bool
+GC_CheckReporterBuffered::initialize()
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+
+	_buffer = (BufferedReport *)forge->allocate(sizeof(BufferedReport) * BUFFER_SIZE, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	return NULL != _buffer;
+}
+
+/**
+ * Destroy the instance of the reporter.  Any reports which have not been flushed are discarded.
+ */
+void
+GC_CheckReporterBuffered::kill()
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+	if (NULL != _buffer) {
+		forge->free(_buffer);
+	}
+	forge->free(this);
+}
+
+/**
+ * Claim the next slot in the buffer.
+ * @return the new report, or NULL if the buffer is full
+ */
+GC_CheckReporterBuffered::BufferedReport *
+GC_CheckReporterBuffered::nextReport(BufferedReportType type, GC_CheckError *error)
+{
+	if (BUFFER_SIZE == _count) {
+		_dropped += 1;
+		return NULL;
+	}
+	BufferedReport *bufferedReport = new(&_buffer[_count]) BufferedReport(type, error);
+	_count += 1;
+	return bufferedReport;
+}
+
+void
+GC_CheckReporterBuffered::report(GC_CheckError *error)
+{
+	if (shouldReport(error)) {
+		nextReport(buffered_report, error);
+	}
+}
+
+void
+GC_CheckReporterBuffered::reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix)
+{
+	if (shouldReport(error)) {
+		BufferedReport *bufferedReport = nextReport(buffered_object_header, error);
+		if (NULL != bufferedReport) {
+			bufferedReport->_subject = (void *)objectPtr;
+			bufferedReport->_prefix = prefix;
+		}
+	}
+}
+
+void
+GC_CheckReporterBuffered::reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix)
+{
+	if (shouldReport(error)) {
+		BufferedReport *bufferedReport = nextReport(buffered_class, error);
+		if (NULL != bufferedReport) {
+			bufferedReport->_subject = (void *)clazz;
+			bufferedReport->_prefix = prefix;
+		}
+	}
+}
+
+void
+GC_CheckReporterBuffered::reportFatalError(GC_CheckError *error)
+{
+	nextReport(buffered_fatal_error, error);
+}
+
+void
+GC_CheckReporterBuffered::reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3)
+{
+	BufferedReport *bufferedReport = nextReport(buffered_heap_walk_error, error);
+	if (NULL != bufferedReport) {
+		bufferedReport->_previousObjectPtr1 = previousObjectPtr1;
+		bufferedReport->_previousObjectPtr2 = previousObjectPtr2;
+		bufferedReport->_previousObjectPtr3 = previousObjectPtr3;
+	}
+}
+
+void
+GC_CheckReporterBuffered::reportForwardedObject(J9Object *objectPtr, J9Object *newObjectPtr)
+{
+	/* not an error, so the object is held in a blank error just to carry it */
+	GC_CheckError error(objectPtr, (GC_CheckCycle *)NULL, (GC_Check *)NULL, J9MODRON_GCCHK_RC_OK, 0);
+	BufferedReport *bufferedReport = nextReport(buffered_forwarded_object, &error);
+	if (NULL != bufferedReport) {
+		bufferedReport->_subject = (void *)newObjectPtr;
+	}
+}
+
+void
+GC_CheckReporterBuffered::reportOwnableSynchronizerNotOnList(J9Object *objectPtr)
+{
+	GC_CheckError error(objectPtr, (GC_CheckCycle *)NULL, (GC_Check *)NULL, J9MODRON_GCCHK_RC_OK, 0);
+	nextReport(buffered_ownable_synchronizer_not_on_list, &error);
+}
+
+void
+GC_CheckReporterBuffered::flush()
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	for (UDATA i = 0; i < _count; i++) {
+		BufferedReport *bufferedReport = &_buffer[i];
+		GC_CheckError *error = &bufferedReport->_error;
+
+		switch (bufferedReport->_type) {
+		case buffered_report:
+			_target->report(error);
+			break;
+		case buffered_object_header:
+			_target->reportObjectHeader(error, (J9Object *)bufferedReport->_subject, bufferedReport->_prefix);
+			break;
+		case buffered_class:
+			_target->reportClass(error, (J9Class *)bufferedReport->_subject, bufferedReport->_prefix);
+			break;
+		case buffered_fatal_error:
+			_target->reportFatalError(error);
+			break;
+		case buffered_heap_walk_error:
+			_target->reportHeapWalkError(error, bufferedReport->_previousObjectPtr1, bufferedReport->_previousObjectPtr2, bufferedReport->_previousObjectPtr3);
+			break;
+		case buffered_forwarded_object:
+			_target->reportForwardedObject((J9Object *)error->_object, (J9Object *)bufferedReport->_subject);
+			break;
+		case buffered_ownable_synchronizer_not_on_list:
+			_target->reportOwnableSynchronizerNotOnList((J9Object *)error->_object);
+			break;
+		default:
+			break;
+		}
+	}
+
+	if (0 != _dropped) {
+		j9tty_printf(PORTLIB, "  <gc check: %zu further reports from a parallel worker were not recorded>\n", _dropped);
+	}
+
+	_count = 0;
+	_dropped = 0;
+}
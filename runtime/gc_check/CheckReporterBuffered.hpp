@@ -0,0 +1,123 @@
+
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#if !defined(CHECKREPORTERBUFFERED_HPP_)
+#define CHECKREPORTERBUFFERED_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "CheckError.hpp"
+#include "CheckReporter.hpp"
+
+/**
+ * Hold the reports of one worker of a parallel check.
+ * Reports are recorded in a fixed size buffer and replayed into the target reporter
+ * by flush(), so that the output of each error stays together when several threads
+ * check the heap at once. Reports which do not fit in the buffer are counted and dropped.
+ * @ingroup GC_Check
+ */
+class GC_CheckReporterBuffered : public GC_CheckReporter
+{
+private:
+	enum { BUFFER_SIZE = 32 }; /**< The number of reports which can be held between flushes */
+
+	typedef enum {
+		buffered_report = 0,
+		buffered_object_header,
+		buffered_class,
+		buffered_fatal_error,
+		buffered_heap_walk_error,
+		buffered_forwarded_object,
+		buffered_ownable_synchronizer_not_on_list
+	} BufferedReportType;
+
+	/**
+	 * A single recorded call on the reporter.
+	 */
+	class BufferedReport {
+	public:
+		BufferedReportType _type;
+		GC_CheckError _error; /**< Copy of the error being reported */
+		void *_subject; /**< The object or class for buffered_object_header and buffered_class, the forwarded object for buffered_forwarded_object */
+		const char *_prefix; /**< The prefix for buffered_object_header and buffered_class */
+		GC_CheckElement _previousObjectPtr1; /**< The previous elements for buffered_heap_walk_error */
+		GC_CheckElement _previousObjectPtr2;
+		GC_CheckElement _previousObjectPtr3;
+
+		BufferedReport(BufferedReportType type, GC_CheckError *error)
+			: _type(type)
+			, _error(*error)
+			, _subject(NULL)
+			, _prefix(NULL)
+			, _previousObjectPtr1()
+			, _previousObjectPtr2()
+			, _previousObjectPtr3()
+		{}
+	};
+
+	GC_CheckReporter *_target; /**< The reporter the buffered reports are replayed into */
+	BufferedReport *_buffer; /**< Storage for BUFFER_SIZE reports */
+	UDATA _count; /**< The number of reports currently held in _buffer */
+	UDATA _dropped; /**< The number of reports which did not fit in _buffer since the last flush */
+
+	BufferedReport *nextReport(BufferedReportType type, GC_CheckError *error);
+	bool initialize();
+
+public:
+	static GC_CheckReporterBuffered *newInstance(J9JavaVM *javaVM, GC_CheckReporter *target);
+	virtual void kill();
+	virtual void report(GC_CheckError *error);
+	virtual void reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix);
+	virtual void reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix);
+	virtual void reportFatalError(GC_CheckError *error);
+	virtual void reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3);
+	virtual void reportForwardedObject(J9Object *objectPtr, J9Object *newObjectPtr);
+	virtual void reportOwnableSynchronizerNotOnList(J9Object *objectPtr);
+
+	/**
+	 * Replay the buffered reports into the target reporter and empty the buffer.
+	 * Callers must ensure that only one thread reports to the target at a time.
+	 */
+	void flush();
+
+	/**
+	 * Create a new CheckReporterBuffered object
+	 */
+	GC_CheckReporterBuffered(J9JavaVM *javaVM, GC_CheckReporter *target) :
+		GC_CheckReporter(javaVM)
+		, _target(target)
+		, _buffer(NULL)
+		, _count(0)
+		, _dropped(0)
+	{
+		setMaxErrorsToReport(target->getMaxErrorsToReport());
+	}
+};
+
+#endif /* CHECKREPORTERBUFFERED_HPP_ */
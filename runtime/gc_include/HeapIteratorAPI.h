@@ -111,6 +111,7 @@ typedef enum J9MM_IteratorFlags {
 	j9mm_iterator_flag_include_arraylet_leaves = 2, /**< Indicates that arraylet leaf pointers should be included in the object ref iterators */
 	j9mm_iterator_flag_exclude_null_refs = 4, /**< Indicates that NULL pointers should be excluded in the object ref iterators */
 	j9mm_iterator_flag_regions_read_only = 8, /**< Indicates that it is read only request (no TLH flush and further heap walk) */
+	j9mm_iterator_flag_abort_region_only = 16, /**< Indicates that an aborting object callback only ends the walk of its region in the all objects iterators */
 	j9mm_iterator_flag_max = 0x1000000
 } J9MM_IteratorFlags;
 
@@ -267,13 +268,29 @@ j9mm_initialize_object_descriptor(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor
 
 /**
  * Walk all objects for the given VM, call user provided function.
- * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param flags The flags describing the walk (0 or any combination of j9mm_iterator_flag_include_holes and j9mm_iterator_flag_abort_region_only)
  * @param func The function to call on each object descriptor.
  * @param userData Pointer to storage for userData.
  */
 jvmtiIterationControl
 j9mm_iterate_all_objects(J9JavaVM *vn, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData), void *userData);
 
+/**
+ * Walk all objects for the given VM using the GC worker threads, call user provided function.
+ * Regions are handed out to the workers one at a time. Each worker calls workerStart once before
+ * walking and passes the context it returns to func for every object it visits. Once the worker has
+ * finished, workerFinish is called with that context to reduce it into userData; calls to workerFinish
+ * are serialized. The calling thread must hold exclusive VM access.
+ * @param flags The flags describing the walk (0 or any combination of j9mm_iterator_flag_include_holes and j9mm_iterator_flag_abort_region_only)
+ * @param func The function to call on each object descriptor, with the worker context.
+ * @param workerStart The function to call on each worker before walking, may be NULL.
+ * @param workerFinish The function to call on each worker after walking, may be NULL.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if any call to func aborted the walk, JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_parallel_iterate_all_objects(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *workerData), void *(*workerStart)(J9JavaVM *vm, void *userData), void (*workerFinish)(J9JavaVM *vm, void *workerData, void *userData), void *userData);
+
 /**
  * Walk all ownable synchronizer object, call user provided function.
  * @param flags The flags describing the walk (unused currently)
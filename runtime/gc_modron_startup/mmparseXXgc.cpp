@@ -437,6 +437,13 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "tarokPGCPauseTargetMillis=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokPGCPauseTargetMillis, "tarokPGCPauseTargetMillis=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokPGCtoGMP=")) {
 			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokPGCtoGMPNumerator, "tarokPGCtoGMP=")) {
 				returnValue = JNI_EINVAL;
@@ -40,6 +40,7 @@ static const char *versionString = "Modron $Name: not supported by cvs2svn $";
 
 #include "mmparse.h"
 
+#include "FinalizerSupport.hpp"
 #include "GCExtensions.hpp"
 #include "Math.hpp"
 
@@ -1241,6 +1242,18 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "finalizeSlaveCount=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeSlaveCount, "finalizeSlaveCount=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if((extensions->finalizeSlaveCount < 1) || (extensions->finalizeSlaveCount > J9_FINALIZE_SLAVE_COUNT_MAX)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "-Xgc:finalizeSlaveCount", (UDATA)1, (UDATA)J9_FINALIZE_SLAVE_COUNT_MAX);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* J9VM_GC_FINALIZATION */
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
@@ -1411,6 +1424,14 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		/* also accepted by -XXgc: */
+		if (try_scan(&scan_start, "tarokPGCPauseTargetMillis=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokPGCPauseTargetMillis, "tarokPGCPauseTargetMillis=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* defined (J9VM_GC_VLHGC) */
 
 		if (try_scan(&scan_start, "verboseFormat=")) {
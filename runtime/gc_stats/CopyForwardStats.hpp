@@ -40,6 +40,9 @@
 
 #include "ReferenceStats.hpp"
 
+/* Number of NUMA nodes, counting from node 1, whose copy-forward destination bytes are recorded individually */
+#define COPYFORWARDSTATS_NUMA_NODE_MAX 16
+
 /**
  * Storage for statistics relevant to a copy forward collector.
  * @ingroup GC_Stats
@@ -64,6 +67,11 @@ public:
 	UDATA _stringConstantsCleared;  /**< The number of string constants that have been cleared during marking */
 	UDATA _stringConstantsCandidates; /**< The number of string constants that have been visited in string table during marking */
 
+	UDATA _copyBytesLocalNode; /**< Bytes copied by a NUMA-affinitized thread into a context on its own node */
+	UDATA _copyBytesRemoteNode; /**< Bytes copied by a NUMA-affinitized thread into a context on another node */
+	UDATA _copyBytesToNode[COPYFORWARDSTATS_NUMA_NODE_MAX + 1]; /**< Bytes copied by NUMA-affinitized threads into contexts on each node (index 0 unused) */
+	UDATA _copyBytesRemoteToNode[COPYFORWARDSTATS_NUMA_NODE_MAX + 1]; /**< Of _copyBytesToNode, the bytes copied by threads affinitized to another node */
+
 private:
 	
 	/* 
@@ -87,6 +95,13 @@ public:
 
 		_stringConstantsCleared = 0;
 		_stringConstantsCandidates = 0;
+
+		_copyBytesLocalNode = 0;
+		_copyBytesRemoteNode = 0;
+		for (UDATA node = 0; node <= COPYFORWARDSTATS_NUMA_NODE_MAX; node++) {
+			_copyBytesToNode[node] = 0;
+			_copyBytesRemoteToNode[node] = 0;
+		}
 	}
 	
 	/**
@@ -106,6 +121,13 @@ public:
 
 		_stringConstantsCleared += stats->_stringConstantsCleared;
 		_stringConstantsCandidates += stats->_stringConstantsCandidates;
+
+		_copyBytesLocalNode += stats->_copyBytesLocalNode;
+		_copyBytesRemoteNode += stats->_copyBytesRemoteNode;
+		for (UDATA node = 0; node <= COPYFORWARDSTATS_NUMA_NODE_MAX; node++) {
+			_copyBytesToNode[node] += stats->_copyBytesToNode[node];
+			_copyBytesRemoteToNode[node] += stats->_copyBytesRemoteToNode[node];
+		}
 	}
 
 	MM_CopyForwardStats() :
@@ -119,7 +141,14 @@ public:
 		,_phantomReferenceStats()
 		,_stringConstantsCleared(0)
 		,_stringConstantsCandidates(0)
-	{}
+		,_copyBytesLocalNode(0)
+		,_copyBytesRemoteNode(0)
+	{
+		for (UDATA node = 0; node <= COPYFORWARDSTATS_NUMA_NODE_MAX; node++) {
+			_copyBytesToNode[node] = 0;
+			_copyBytesRemoteToNode[node] = 0;
+		}
+	}
 };
 
 #endif /* J9VM_GC_VLHGC */
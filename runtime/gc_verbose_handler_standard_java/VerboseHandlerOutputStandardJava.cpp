@@ -79,6 +79,7 @@ void
 MM_VerboseHandlerOutputStandardJava::outputMemoryInfoInnerStanzaInternal(MM_EnvironmentBase *env, UDATA indent, MM_CollectionStatistics *statsBase)
 {
 	MM_VerboseHandlerJava::outputFinalizableInfo(_manager, env, indent);
+	MM_VerboseHandlerJava::outputStackMapCacheInfo(_manager, env, indent);
 }
 
 void
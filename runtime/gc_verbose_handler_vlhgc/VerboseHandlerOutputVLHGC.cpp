@@ -350,6 +350,7 @@ MM_VerboseHandlerOutputVLHGC::outputMemoryInfoInnerStanza(MM_EnvironmentBase *en
 	}
 
 	MM_VerboseHandlerJava::outputFinalizableInfo(_manager, env, indent);
+	MM_VerboseHandlerJava::outputStackMapCacheInfo(_manager, env, indent);
 
 	UDATA rememberedSetFreePercent = (UDATA)((100 * (U_64)stats->_rememberedSetBytesFree) / ((U_64)stats->_rememberedSetBytesTotal));
 
@@ -400,6 +401,16 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 				copyForwardStats->_copyObjectsNonEden, copyForwardStats->_copyBytesNonEden, copyForwardStats->_copyDiscardBytesNonEden);
 	writer->formatAndOutput(env, 1, "<memory-cardclean objects=\"%zu\" bytes=\"%zu\" />",
 				copyForwardStats->_objectsCardClean, copyForwardStats->_bytesCardClean);
+	if (0 != (copyForwardStats->_copyBytesLocalNode + copyForwardStats->_copyBytesRemoteNode)) {
+		writer->formatAndOutput(env, 1, "<memory-copied-numa localbytes=\"%zu\" remotebytes=\"%zu\" />",
+					copyForwardStats->_copyBytesLocalNode, copyForwardStats->_copyBytesRemoteNode);
+		for (UDATA node = 1; node <= COPYFORWARDSTATS_NUMA_NODE_MAX; node++) {
+			if (0 != copyForwardStats->_copyBytesToNode[node]) {
+				writer->formatAndOutput(env, 1, "<memory-copied-numa-node node=\"%zu\" bytes=\"%zu\" remotebytes=\"%zu\" />",
+							node, copyForwardStats->_copyBytesToNode[node], copyForwardStats->_copyBytesRemoteToNode[node]);
+			}
+		}
+	}
 	if(copyForwardStats->_aborted || (0 != copyForwardStats->_nonEvacuateRegionCount)) {
 		writer->formatAndOutput(env, 1, "<memory-traced type=\"eden\" objects=\"%zu\" bytes=\"%zu\" />",
 					copyForwardStats->_scanObjectsEden, copyForwardStats->_scanBytesEden);
@@ -48,6 +48,27 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	if((0 != systemCount) || (0 != defaultCount) || (0 != referenceCount) || (0 != classloaderCount)) {
 		manager->getWriterChain()->formatAndOutput(env, indent, "<pending-finalizers system=\"%zu\" default=\"%zu\" reference=\"%zu\" classloader=\"%zu\" />", systemCount, defaultCount, referenceCount, classloaderCount);
 	}
+
+	UDATA consumedCount = finalizeListManager->getConsumedJobCount();
+	if (0 != consumedCount) {
+		manager->getWriterChain()->formatAndOutput(env, indent, "<finalizer-progress consumed=\"%zu\" threads=\"%zu\" />", consumedCount, extensions->finalizeSlaveCount);
+	}
+}
+
+void
+MM_VerboseHandlerJava::outputStackMapCacheInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent)
+{
+	J9JavaVM *javaVM = (J9JavaVM *)env->getOmrVM()->_language_vm;
+	J9DirectMappedCache *stackMapCache = javaVM->stackMapCache;
+
+	if (NULL != stackMapCache) {
+		UDATA hits = stackMapCache->hits;
+		UDATA misses = stackMapCache->misses;
+
+		if ((0 != hits) || (0 != misses)) {
+			manager->getWriterChain()->formatAndOutput(env, indent, "<stackmap-cache hits=\"%zu\" misses=\"%zu\" />", hits, misses);
+		}
+	}
 }
 
 bool
@@ -35,13 +35,22 @@ class MM_VerboseHandlerJava : public MM_Base
 {
 public:
 	/**
-	 * Output finalizable list summary.
+	 * Output finalizable list summary, followed by the number of jobs the finalizer threads have
+	 * taken off the lists since startup (successive values give the drain rate).
 	 * @param manager
 	 * @param env GC thread used for output.
 	 * @param indent base level of indentation for the summary.
 	 */
 	static void outputFinalizableInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
 
+	/**
+	 * Output the hits and misses of the interpreter stack map cache since the VM started.
+	 * @param manager
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	static void outputStackMapCacheInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
+
 	/**
 	 * Output the name of the thread into the buffer.
 	 * @return Whether the thread name was truncated.
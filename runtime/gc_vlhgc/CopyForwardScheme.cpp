@@ -1652,12 +1652,37 @@ MM_CopyForwardScheme::mergeGCStats(MM_EnvironmentVLHGC *env)
 	Assert_MM_true(0 == localStats->_copyBytesNonEden);
 	Assert_MM_true(0 == localStats->_copyDiscardBytesNonEden);
 
+	/* node 0 means the thread has no affinity, in which case copy locality isn't reported */
+	UDATA nodeOfThread = 0;
+	if (_extensions->_numaManager.isPhysicalNUMASupported()) {
+		nodeOfThread = env->getNumaAffinity();
+	}
+
 	/* sum up the per-compact group data before entering the lock */
 	for (UDATA compactGroupNumber = 0; compactGroupNumber < _compactGroupMaxCount; compactGroupNumber++) {
 		MM_CopyForwardCompactGroup *compactGroup = &env->_copyForwardCompactGroups[compactGroupNumber];
 		UDATA totalCopiedBytes = compactGroup->_edenStats._copiedBytes + compactGroup->_nonEdenStats._copiedBytes;
 		UDATA totalLiveBytes = compactGroup->_edenStats._liveBytes + compactGroup->_nonEdenStats._liveBytes;
 
+		if ((0 != nodeOfThread) && (0 != totalCopiedBytes)) {
+			/* the compact group identifies the destination context, and so the node the bytes were copied to */
+			UDATA contextNumber = MM_CompactGroupManager::getAllocationContextNumberFromGroup(env, compactGroupNumber);
+			MM_AllocationContextTarok *destinationContext = (MM_AllocationContextTarok *)_extensions->globalAllocationManager->getAllocationContextByIndex(contextNumber);
+			UDATA destinationNode = destinationContext->getNumaNode();
+			if (destinationNode == nodeOfThread) {
+				localStats->_copyBytesLocalNode += totalCopiedBytes;
+			} else if (0 != destinationNode) {
+				localStats->_copyBytesRemoteNode += totalCopiedBytes;
+			}
+			/* nodes past the recorded range are still counted in the local and remote totals above */
+			if ((0 != destinationNode) && (destinationNode <= COPYFORWARDSTATS_NUMA_NODE_MAX)) {
+				localStats->_copyBytesToNode[destinationNode] += totalCopiedBytes;
+				if (destinationNode != nodeOfThread) {
+					localStats->_copyBytesRemoteToNode[destinationNode] += totalCopiedBytes;
+				}
+			}
+		}
+
 		localStats->_copyObjectsTotal += compactGroup->_edenStats._copiedObjects + compactGroup->_nonEdenStats._copiedObjects;
 		localStats->_copyBytesTotal += totalCopiedBytes;
 		localStats->_scanObjectsTotal += compactGroup->_edenStats._scannedObjects + compactGroup->_nonEdenStats._scannedObjects;
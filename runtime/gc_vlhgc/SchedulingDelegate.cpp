@@ -86,6 +86,7 @@ MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapR
 	, _averageCopyForwardBytesDiscarded(0.0)
 	, _averageSurvivorSetRegionCount(0.0)
 	, _averageCopyForwardRate(1.0)
+	, _measuredCopyForwardRate(0.0)
 	, _averageMacroDefragmentationWork(0.0)
 	, _currentMacroDefragmentationWork(0)
 	, _didGMPCompleteSinceLastReclaim(false)
@@ -891,6 +892,14 @@ MM_SchedulingDelegate::copyForwardCompleted(MM_EnvironmentVLHGC *env)
 	
 	_averageSurvivorSetRegionCount = (_averageSurvivorSetRegionCount * historicWeight) + ((double)survivorSetRegionCount * (1.0 - historicWeight));
 	_averageCopyForwardRate = (_averageCopyForwardRate * historicWeight) + (copyForwardRate * (1.0 - historicWeight));
+	if (0.0 < copyForwardRate) {
+		/* unlike _averageCopyForwardRate, start from the first sample rather than from an arbitrary seed, and ignore copy-forwards which copied nothing */
+		if (0.0 == _measuredCopyForwardRate) {
+			_measuredCopyForwardRate = copyForwardRate;
+		} else {
+			_measuredCopyForwardRate = (_measuredCopyForwardRate * historicWeight) + (copyForwardRate * (1.0 - historicWeight));
+		}
+	}
 
 	Trc_MM_SchedulingDelegate_copyForwardCompleted_efficiency(
 		env->getLanguageVMThread(),
@@ -994,6 +1003,17 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 	} else if (desiredEdenCount < edenMinimumCount) {
 		desiredEdenCount = edenMinimumCount;
 	}
+	/* the cap is only applied once a copy-forward rate has been measured, as there is nothing to predict the pause from before that */
+	if ((0 != _extensions->tarokPGCPauseTargetMillis) && (0.0 < _measuredCopyForwardRate) && (0.0 < _edenSurvivalRateCopyForward)) {
+		/* cap Eden such that the copy-forward of its expected survivors (plus the non-Eden survivors) fits within the requested pause target */
+		double copyableBytes = (double)_extensions->tarokPGCPauseTargetMillis * 1000.0 * _measuredCopyForwardRate;
+		double copyableRegions = (copyableBytes / (double)regionSize) - (double)_nonEdenSurvivalCountCopyForward;
+		UDATA pauseBoundEdenCount = 0;
+		if (copyableRegions > 0.0) {
+			pauseBoundEdenCount = (UDATA)(copyableRegions / _edenSurvivalRateCopyForward);
+		}
+		desiredEdenCount = OMR_MAX(OMR_MIN(desiredEdenCount, pauseBoundEdenCount), edenMinimumCount);
+	}
 	Trc_MM_SchedulingDelegate_calculateEdenSize_dynamic(env->getLanguageVMThread(), desiredEdenCount, _edenSurvivalRateCopyForward, _nonEdenSurvivalCountCopyForward, freeRegions, edenMinimumCount, edenMaximumCount);
 	if (desiredEdenCount <= freeRegions) {
 		_edenRegionCount = desiredEdenCount;
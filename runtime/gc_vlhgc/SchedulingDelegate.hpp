@@ -64,6 +64,7 @@ private:
 	double _averageCopyForwardBytesDiscarded; /**< Weighted average of bytes discarded (lost) by the copy-forward scheme */
 	double _averageSurvivorSetRegionCount; /**< Weighted average of survivor regions */
 	double _averageCopyForwardRate; /**< Weighted average of (bytesCopied / timeSpentInCopyForward).  Disregards time spent related RSCL clearing. Measured in bytes/microseconds */
+	double _measuredCopyForwardRate; /**< Same as _averageCopyForwardRate, but only from copy-forwards which copied something, and 0.0 until the first one completes.  Used to apply tarokPGCPauseTargetMillis */
 	double _averageMacroDefragmentationWork; /**< Average work to be done to mitigate influx of fragmented regions into the oldest age */
 	UDATA _currentMacroDefragmentationWork;	 /**< As we age out regions and find macro defrag work, we sum it up */
 	bool _didGMPCompleteSinceLastReclaim; /**< true if a GMP completed since the last reclaim cycle */
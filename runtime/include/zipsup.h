@@ -159,6 +159,22 @@ typedef struct J9ZipDirEntry {
 #define J9ZIPDIRENTRY_FILELIST(base) WSRP_GET((base)->fileList, struct J9ZipFileRecord*)
 #define J9ZIPDIRENTRY_DIRLIST(base) WSRP_GET((base)->dirList, struct J9ZipDirEntry*)
 
+typedef struct J9ZipHashSlot {
+    J9WSRP parent;
+    J9WSRP entry;
+    UDATA hash;
+} J9ZipHashSlot;
+
+#define J9ZIPHASHSLOT_PARENT(base) WSRP_GET((base)->parent, struct J9ZipDirEntry*)
+#define J9ZIPHASHSLOT_ENTRY(base) WSRP_GET((base)->entry, void*)
+
+typedef struct J9ZipHashIndex {
+    UDATA capacity;
+    UDATA count;
+    UDATA flags;
+    struct J9ZipHashSlot slots[1];
+} J9ZipHashIndex;
+
 typedef struct J9ZipCacheEntry {
     J9WSRP zipFileName;
     IDATA zipFileSize;
@@ -166,12 +182,14 @@ typedef struct J9ZipCacheEntry {
     IDATA startCentralDir;
     J9WSRP currentChunk;
     J9WSRP chunkActiveDir;
+    J9WSRP hashIndex;
     struct J9ZipDirEntry root;
 } J9ZipCacheEntry;
 
 #define J9ZIPCACHEENTRY_ZIPFILENAME(base) WSRP_GET((base)->zipFileName, U_8*)
 #define J9ZIPCACHEENTRY_CURRENTCHUNK(base) WSRP_GET((base)->currentChunk, struct J9ZipChunkHeader*)
 #define J9ZIPCACHEENTRY_CHUNKACTIVEDIR(base) WSRP_GET((base)->chunkActiveDir, struct J9ZipDirEntry*)
+#define J9ZIPCACHEENTRY_HASHINDEX(base) WSRP_GET((base)->hashIndex, struct J9ZipHashIndex*)
 #define J9ZIPCACHEENTRY_NEXT(base) WSRP_GET((&((base)->root))->next, struct J9ZipDirEntry*)
 #define J9ZIPCACHEENTRY_FILELIST(base) WSRP_GET((&((base)->root))->fileList, struct J9ZipFileRecord*)
 #define J9ZIPCACHEENTRY_DIRLIST(base) WSRP_GET((&((base)->root))->dirList, struct J9ZipDirEntry*)
@@ -20,6 +20,9 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <stddef.h>
+#include <string.h>
+
 #include "j2sever.h"
 #include "j9.h"
 #include "j9cp.h"
@@ -28,9 +31,28 @@
 #include "objhelp.h"
 #include "omrgcconsts.h"
 #include "rommeth.h"
+#include "ut_j9jcl.h"
+#include "util_api.h"
 #include "vm_api.h"
 
+/*
+ * StackTraceElements are immutable and their contents depend only on the ROM method, the class
+ * loader and the line number of the frame, so exceptions thrown repeatedly through the same code
+ * can share them.  The elements built for recent frames are interned in a direct mapped cache
+ * (see util/directmappedcache.c) keyed by ROM method and line number, whose value is the class loader.
+ *
+ * Each entry of the cache has a weak global reference which is created the first time the entry is
+ * written and is then reused for every element stored in that entry, so lookups never lock and
+ * never see a reference being freed; the GC clears the reference once no stack trace uses its element.
+ * The references are freed with the rest of the JNI references when the VM shuts down.
+ */
+
+#define J9_STACKTRACEELEMENT_CACHE_SIZE 1024 /* must be a power of two */
+
 static UDATA getStackTraceIterator(J9VMThread * vmThread, void * voidUserData, J9ROMClass * romClass, J9ROMMethod * romMethod, J9UTF8 * fileName, UDATA lineNumber, J9ClassLoader* classLoader);
+static BOOLEAN canInternStackTraceElements(J9JavaVM *vm);
+static j9object_t lookupStackTraceElement(J9VMThread *vmThread, J9ROMMethod *romMethod, J9ClassLoader *classLoader, UDATA lineNumber, UDATA *generation);
+static void internStackTraceElement(J9VMThread *vmThread, J9ROMMethod *romMethod, J9ClassLoader *classLoader, UDATA lineNumber, UDATA generation, j9object_t element);
 
 /**
  * Saves enough context into the StackTraceElement to allow printing later.  For
@@ -89,6 +111,9 @@ getStackTraceIterator(J9VMThread * vmThread, void * voidUserData, J9ROMClass * r
 	J9InternalVMFunctions * vmfns = vm->internalVMFunctions;
 	j9object_t element = NULL;
 	UDATA rc = TRUE;
+	/* the line number is adjusted below before it is stored, but the element is interned under the original */
+	UDATA frameLineNumber = lineNumber;
+	UDATA cacheGeneration = 0;
 
 	/* If the stack trace is larger than the array, bail */
 
@@ -97,6 +122,18 @@ getStackTraceIterator(J9VMThread * vmThread, void * voidUserData, J9ROMClass * r
 		return FALSE;
 	}
 
+	/* Share the element built for an identical frame of an earlier stack trace, if it is still alive */
+
+	if (romMethod != NULL) {
+		element = lookupStackTraceElement(vmThread, romMethod, classLoader, frameLineNumber, &cacheGeneration);
+		if (element != NULL) {
+			j9array_t result = (j9array_t) PEEK_OBJECT_IN_SPECIAL_FRAME(vmThread, 0);
+			J9JAVAARRAYOFOBJECT_STORE(vmThread, result, (I_32)userData->index, element);
+			userData->index += 1;
+			return TRUE;
+		}
+	}
+
 	/* Prevent the current class from being unloaded during allocation */
 	PUSH_OBJECT_IN_SPECIAL_FRAME(vmThread, (NULL == classLoader) ? NULL : classLoader->classLoaderObject);
 
@@ -212,6 +249,10 @@ getStackTraceIterator(J9VMThread * vmThread, void * voidUserData, J9ROMClass * r
 				setStackTraceElementSource(vmThread, element, classLoader, romClass);
 			}
 
+			if (vmThread->currentException == NULL) {
+				internStackTraceElement(vmThread, romMethod, classLoader, frameLineNumber, cacheGeneration, PEEK_OBJECT_IN_SPECIAL_FRAME(vmThread, 0));
+			}
+
 done:
 			DROP_OBJECT_IN_SPECIAL_FRAME(vmThread);
 		}
@@ -285,3 +326,136 @@ retry:
 
 	return result;
 }
+
+IDATA
+initializeStackTraceElementCache(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	UDATA cacheSize = offsetof(J9StackTraceElementCache, elements) + (J9_STACKTRACEELEMENT_CACHE_SIZE * sizeof(jobject));
+	J9StackTraceElementCache *cache = j9mem_allocate_memory(cacheSize, J9MEM_CATEGORY_VM_JCL);
+
+	if (NULL == cache) {
+		Trc_JCL_initializeStackTraceElementCache_allocationFailure(cacheSize);
+		return -1;
+	}
+	memset(cache, 0, cacheSize);
+
+	cache->table = directMappedCacheNew(vm, J9_STACKTRACEELEMENT_CACHE_SIZE, J9MEM_CATEGORY_VM_JCL);
+	if (NULL == cache->table) {
+		Trc_JCL_initializeStackTraceElementCache_allocationFailure(offsetof(J9DirectMappedCache, entries) + (J9_STACKTRACEELEMENT_CACHE_SIZE * sizeof(J9DirectMappedCacheEntry)));
+		j9mem_free_memory(cache);
+		return -1;
+	}
+
+	vm->stackTraceElementCache = cache;
+	return 0;
+}
+
+void
+freeStackTraceElementCache(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9StackTraceElementCache *cache = vm->stackTraceElementCache;
+
+	if (NULL != cache) {
+		/* the weak global references are freed with the rest of the JNI references */
+		directMappedCacheFree(cache->table);
+		j9mem_free_memory(cache);
+		vm->stackTraceElementCache = NULL;
+	}
+}
+
+/**
+ * Elements built before java.base is defined record a placeholder module, so they are not shared.
+ * @param vm
+ * @return TRUE if elements may be interned, FALSE otherwise.
+ */
+static BOOLEAN
+canInternStackTraceElements(J9JavaVM *vm)
+{
+	if (NULL == vm->stackTraceElementCache) {
+		return FALSE;
+	}
+	if ((J2SE_VERSION(vm) & J2SE_VERSION_MASK) >= J2SE_19) {
+		return J9_ARE_ANY_BITS_SET(vm->runtimeFlags, J9_RUNTIME_JAVA_BASE_MODULE_CREATED);
+	}
+	return TRUE;
+}
+
+/**
+ * Find a live StackTraceElement built for the same frame.  Does not block.
+ * @param vmThread
+ * @param romMethod
+ * @param classLoader
+ * @param lineNumber The line number as reported by the stack trace iterator.
+ * @param generation Receives the cache generation to pass to internStackTraceElement on a miss.
+ * @return the element, or NULL if there is none.
+ * @note Assumes VM access
+ */
+static j9object_t
+lookupStackTraceElement(J9VMThread *vmThread, J9ROMMethod *romMethod, J9ClassLoader *classLoader, UDATA lineNumber, UDATA *generation)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9StackTraceElementCache *cache = vm->stackTraceElementCache;
+	j9object_t element = NULL;
+
+	if (canInternStackTraceElements(vm)) {
+		J9DirectMappedCache *table = cache->table;
+		UDATA cachedClassLoader = 0;
+		UDATA sequence = 0;
+		J9DirectMappedCacheEntry *entry = NULL;
+
+		*generation = table->generation;
+		entry = directMappedCacheBeginLookup(table, romMethod, lineNumber, &cachedClassLoader, &sequence);
+		if ((NULL != entry) && ((UDATA)classLoader == cachedClassLoader)) {
+			jobject elementRef = cache->elements[entry - table->entries];
+
+			if (NULL != elementRef) {
+				/* NULL if the GC has cleared the reference */
+				element = vm->memoryManagerFunctions->j9gc_objaccess_readObjectFromInternalVMSlot(vmThread, (j9object_t *)elementRef);
+			}
+			if (!directMappedCacheEndLookup(entry, sequence)) {
+				/* the entry was rewritten while it was being read */
+				element = NULL;
+			}
+		}
+	}
+
+	return element;
+}
+
+/**
+ * Remember a fully initialized StackTraceElement so that identical frames can share it.
+ * Does nothing if another thread is interning an element in the same entry.
+ * @param vmThread
+ * @param romMethod
+ * @param classLoader
+ * @param lineNumber The line number as reported by the stack trace iterator.
+ * @param generation The generation returned by lookupStackTraceElement before the element was built.
+ * @param element
+ * @note Assumes VM access
+ */
+static void
+internStackTraceElement(J9VMThread *vmThread, J9ROMMethod *romMethod, J9ClassLoader *classLoader, UDATA lineNumber, UDATA generation, j9object_t element)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9StackTraceElementCache *cache = vm->stackTraceElementCache;
+
+	if (canInternStackTraceElements(vm) && (0 != generation)) {
+		J9DirectMappedCache *table = cache->table;
+		UDATA sequence = 0;
+		J9DirectMappedCacheEntry *entry = directMappedCacheBeginStore(table, romMethod, lineNumber, &sequence);
+
+		if (NULL != entry) {
+			jobject *elementRef = &cache->elements[entry - table->entries];
+
+			if (NULL == *elementRef) {
+				/* creating the reference does not release VM access, so element remains valid */
+				*elementRef = vm->internalVMFunctions->j9jni_createGlobalRef((JNIEnv *)vmThread, element, JNI_TRUE);
+			} else {
+				vm->memoryManagerFunctions->j9gc_objaccess_storeObjectToInternalVMSlot(vmThread, (j9object_t *)*elementRef, element);
+			}
+			directMappedCacheEndStore(entry, romMethod, lineNumber, generation, (UDATA)classLoader, sequence);
+		}
+	}
+}
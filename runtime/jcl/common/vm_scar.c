@@ -346,6 +346,9 @@ J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 				return J9VMDLLMAIN_FAILED;
 			}
 
+			/* Interning StackTraceElements only reduces garbage, so run without it if the cache cannot be created */
+			initializeStackTraceElementCache(vm);
+
 			/* TODO: Can this be removed? */
 			vm->jclFlags |=
 				J9_JCL_FLAG_REFERENCE_OBJECTS | 
@@ -417,6 +420,7 @@ J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 				iniBootpath = NULL;
 			}
 			freeUnsafeMemory(vm);
+			freeStackTraceElementCache(vm);
 			break;
 			
 		case OFFLOAD_JCL_PRECONFIGURE:
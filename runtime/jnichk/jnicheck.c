@@ -1135,6 +1135,7 @@ jniIsGlobalRef(JNIEnv* env, jobject reference)
 	enterVM(vmThread);
 
 #ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_enter(vm->jniGlobalReferencesMutex);
 	omrthread_monitor_enter(vm->jniFrameMutex);
 #endif
 	/* walk the JNIGlobalReferences pool */
@@ -1158,6 +1159,7 @@ jniIsGlobalRef(JNIEnv* env, jobject reference)
 	}
 #ifdef J9VM_THR_PREEMPTIVE
 	omrthread_monitor_exit(vm->jniFrameMutex);
+	omrthread_monitor_exit(vm->jniGlobalReferencesMutex);
 #endif
 
 	exitVM(vmThread);
@@ -1262,12 +1264,12 @@ static UDATA jniIsWeakGlobalRef(JNIEnv* env, jobject reference) {
 	enterVM(vmThread);
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
+	omrthread_monitor_enter(vm->jniWeakGlobalReferencesMutex);
 #endif
 	/* walk the JNIWeakGlobalReferences pool */
 	rc = pool_includesElement(vm->jniWeakGlobalReferences, reference);
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
+	omrthread_monitor_exit(vm->jniWeakGlobalReferencesMutex);
 #endif
 
 	exitVM(vmThread);
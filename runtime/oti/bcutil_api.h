@@ -385,7 +385,7 @@ jimagePackageToModule(J9JImageIntf *jimageIntf, UDATA handle, const char *packag
  * This function loads jimage file specified by fileName. As part of loading it performs following operation:
  * 1) Open jimage file and read the header
  * 2) Verify header
- * 3) Memory map jimage file upto start of resources
+ * 3) Memory map the whole jimage file, or only up to the start of resources if that fails
  * 4) Create J9JImage and J9JImageHeader structure and populate the fields
  *
  * @param [in] vm pointer to J9JavaVM
@@ -123,6 +123,7 @@ typedef struct J9RASdumpAgent {
 #define J9RAS_DUMP_DO_ATTACH_THREAD  32
 #define J9RAS_DUMP_DO_MULTIPLE_HEAPS  64
 #define J9RAS_DUMP_DO_PREEMPT_THREADS  0x80
+#define J9RAS_DUMP_DO_HALT_PER_THREAD  0x100
 
 typedef struct J9RASdumpContext {
 	struct J9JavaVM* javaVM;
@@ -38,6 +38,7 @@
 
 #define J9VM_DLT_HISTORY_SIZE  16
 #define J9VM_OBJECT_MONITOR_CACHE_SIZE  32
+#define J9VM_INTERFACE_CALL_CACHE_SIZE  32
 #define J9VM_ASYNC_MAX_HANDLERS 32
 
 #define CLASSNAME_INVALID			0
@@ -1893,6 +1894,7 @@ typedef struct J9BytecodeVerificationData {
 	U_8* classNameSegment;
 	U_8* classNameSegmentFree;
 	U_8* classNameSegmentEnd;
+	UDATA* compatibilityCache;
 	U_32* bytecodeMap;
 	UDATA bytecodeMapSize;
 	UDATA* stackMaps;
@@ -2439,6 +2441,8 @@ typedef struct J9StackWalkState {
 	void* inlinedCallSite;
 	void* stackMap;
 	void* inlineMap;
+	UDATA mapCacheHits;
+	UDATA mapCacheMisses;
 } J9StackWalkState;
 
 #define J9_STACKWALK_SLOT_TYPE_JIT_REGISTER_MAP  5
@@ -2447,6 +2451,30 @@ typedef struct J9StackWalkState {
 #define J9_STACKWALK_SLOT_TYPE_PENDING  3
 #define J9_STACKWALK_SLOT_TYPE_METHOD_LOCAL  1
 
+/* A value cached for a ROM method (or other owner) and key, see util/directmappedcache.c */
+typedef struct J9DirectMappedCacheEntry {
+	volatile UDATA sequence;
+	void* owner;
+	UDATA key;
+	UDATA generation;
+	UDATA value;
+} J9DirectMappedCacheEntry;
+
+typedef struct J9DirectMappedCache {
+	struct J9JavaVM* javaVM;
+	volatile UDATA generation;
+	volatile UDATA hits;
+	volatile UDATA misses;
+	UDATA mask;
+	struct J9DirectMappedCacheEntry entries[1];
+} J9DirectMappedCache;
+
+/* The interned java/lang/StackTraceElements, see jcl/common/jclexception.c */
+typedef struct J9StackTraceElementCache {
+	struct J9DirectMappedCache* table;
+	jobject elements[1];
+} J9StackTraceElementCache;
+
 typedef struct J9OSRFrame {
 	UDATA flags;
 	struct J9Method* method;
@@ -4399,6 +4427,7 @@ typedef struct J9MemoryManagerFunctions {
 	I_32  ( *j9gc_get_jit_string_dedup_policy)(struct J9JavaVM *javaVM) ;
 	UDATA ( *j9gc_stringHashFn)(void *key, void *userData);
 	UDATA ( *j9gc_stringHashEqualFn)(void *leftKey, void *rightKey, void *userData);
+	jvmtiIterationControl  ( *j9mm_parallel_iterate_all_objects)(struct J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateObjectDescriptor *object, void *workerData), void *(*workerStart)(struct J9JavaVM *vm, void *userData), void (*workerFinish)(struct J9JavaVM *vm, void *workerData, void *userData), void *userData) ;
 } J9MemoryManagerFunctions;
 
 typedef struct J9InternalVMFunctions {
@@ -4748,6 +4777,13 @@ typedef struct J9InvocationJavaVM {
 	J9NativeLibrary * reserved2_library;
 } J9InvocationJavaVM;
 
+/* Entry in the per-thread interpreter invokeinterface cache, keyed by (call site constant pool slot, receiver class) */
+typedef struct J9InterfaceCallCacheEntry {
+	struct J9RAMInterfaceMethodRef* methodRef;
+	struct J9Class* receiverClass;
+	struct J9Method* method;
+} J9InterfaceCallCacheEntry;
+
 /* @ddr_namespace: map_to_type=J9VMThread */
 
 typedef struct J9VMThread {
@@ -4935,6 +4971,9 @@ typedef struct J9VMThread {
 #endif /* J9VM_GC_COMPRESSED_POINTERS */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	UDATA safePointCount;
+	struct J9InterfaceCallCacheEntry interfaceCallCache[J9VM_INTERFACE_CALL_CACHE_SIZE];
+	UDATA interfaceCallCacheHits;
+	UDATA interfaceCallCacheMisses;
 } J9VMThread;
 
 #define J9VMTHREAD_ALIGNMENT  0x100
@@ -5110,6 +5149,8 @@ typedef struct J9JavaVM {
 	j9object_t destroyVMState;
 	omrthread_monitor_t segmentMutex;
 	omrthread_monitor_t jniFrameMutex;
+	omrthread_monitor_t jniGlobalReferencesMutex;
+	omrthread_monitor_t jniWeakGlobalReferencesMutex;
 	UDATA verboseLevel;
 	UDATA finalizeFlags;
 	UDATA rsOverflow;
@@ -5307,6 +5348,9 @@ typedef struct J9JavaVM {
 	U_8* mapMemoryResultsBuffer;
 	UDATA mapMemoryBufferSize;
 	omrthread_monitor_t mapMemoryBufferMutex;
+	struct J9DirectMappedCache* stackMapCache;
+	struct J9DirectMappedCache* lineNumberCache;
+	struct J9StackTraceElementCache* stackTraceElementCache;
 	omrthread_monitor_t jclCacheMutex;
 	UDATA arrayletLeafSize;
 	UDATA arrayletLeafLogSize;
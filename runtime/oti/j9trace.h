@@ -41,6 +41,18 @@ extern "C" {
  */
 typedef omr_error_t (*ConfigureTraceFunction)(void *,const char *);
 
+/**
+ * Invocation count for a method traced in sampling mode (-Xtrace:methodsample=nn).
+ * Entries live in an open addressed table indexed by J9Method address.
+ */
+typedef struct RasMethodSample {
+	struct J9Method *method;
+	UDATA count;
+} RasMethodSample;
+
+/* Marks a table entry whose method was unloaded; the slot is never reused */
+#define RAS_METHOD_SAMPLE_REMOVED ((struct J9Method *)(UDATA)1)
+
 typedef struct RasGlobalStorage {
 	/* The utGlobalData reference here is unused by all Java code and inaccessible to OMR code
 	 * however it is required to allow DDR debug extensions that work with trace a way to find
@@ -61,6 +73,9 @@ typedef struct RasGlobalStorage {
 	int     stackdepth;
 	unsigned int    stackCompressionLevel;
 	ConfigureTraceFunction configureTraceEngine;
+	unsigned int    methodSampleInterval;
+	UDATA           methodSampleTableSize;
+	RasMethodSample *methodSamples;
 } RasGlobalStorage;
 
 #define RAS_GLOBAL(x) ((RasGlobalStorage *)thr->javaVM->j9rasGlobalStorage)->x 
@@ -615,6 +615,10 @@ Java_com_ibm_tools_attach_target_IPC_tracepoint(JNIEnv *env, jclass clazz, jint
 /* J9SourceJclExceptionSupport*/
 extern J9_CFUNC j9array_t  
 getStackTrace (J9VMThread * vmThread, j9object_t* exceptionAddr, UDATA pruneConstructors);
+extern J9_CFUNC IDATA
+initializeStackTraceElementCache (J9JavaVM *vm);
+extern J9_CFUNC void
+freeStackTraceElementCache (J9JavaVM *vm);
 
 /* J9SourceJclClearInit*/
 extern J9_CFUNC jint JNICALL JVM_OnLoad (JavaVM * jvm, char *options, void *reserved);
@@ -100,6 +100,7 @@ typedef struct J9JImage {
 	U_64 fileLength;
 	struct J9JImageHeader *j9jimageHeader;
 	J9MmapHandle *jimageMmap;
+	U_64 jimageMmapSize;		/* number of bytes from the start of the jimage file covered by jimageMmap */
 } J9JImage;
 
 typedef struct DecompressorInfo {
@@ -80,6 +80,38 @@ U_32 * j9mapmemory_GetResultsBuffer(void * userData) ;
 void j9mapmemory_ReleaseResultsBuffer(void * userData);
 
 
+/* ---------------- mapcache.c ---------------- */
+
+/* The key of a map in vm->stackMapCache.  The slot count is at most 32, as only maps which fit in a single U_32 are cached */
+#define J9_STACKMAP_CACHE_KEY(pc, slotCount, isStackMap) \
+	(((UDATA)(pc) << 7) | ((UDATA)(slotCount) << 1) | ((isStackMap) ? 1 : 0))
+
+/**
+* @brief Allocate the VM-wide stack map cache and register the hooks which invalidate it.
+* The cache is an optimization only; if it cannot be created, vm->stackMapCache remains NULL.
+* @param vm
+* @return 0 on success, -1 on failure
+*/
+IDATA
+j9mapcache_initialize(J9JavaVM *vm);
+
+/**
+* @brief Free the VM-wide stack map cache.
+* @param vm
+* @return Void.
+*/
+void
+j9mapcache_free(J9JavaVM *vm);
+
+/**
+* @brief Invalidate every entry in the stack map cache, e.g. because ROM methods have been unloaded.
+* @param vm
+* @return Void.
+*/
+void
+j9mapcache_invalidate(J9JavaVM *vm);
+
+
 /* ---------------- fixreturns.c ---------------- */
 
 struct J9ROMClass;
@@ -163,6 +163,114 @@ instanceOfOrCheckCastNoCacheUpdate( J9Class *instanceClass, J9Class *castClass )
 char *getDefineArgument(char* arg, char* key);
 
 
+/* ---------------- directmappedcache.c ---------------- */
+
+/**
+* @brief Allocate a direct mapped cache and register the hooks which invalidate it when classes are unloaded or redefined.
+* @param vm
+* @param entryCount the number of entries, which must be a power of two
+* @param memoryCategory
+* @return the cache, or NULL on failure
+*/
+J9DirectMappedCache *
+directMappedCacheNew(J9JavaVM *vm, UDATA entryCount, U_32 memoryCategory);
+
+/**
+* @brief Unregister the hooks of a direct mapped cache and free it.
+* @param cache may be NULL
+* @return Void.
+*/
+void
+directMappedCacheFree(J9DirectMappedCache *cache);
+
+/**
+* @brief Invalidate every entry in the cache.
+* @param cache
+* @return the new generation
+*/
+UDATA
+directMappedCacheInvalidate(J9DirectMappedCache *cache);
+
+/**
+* @brief Start reading the entry for owner and key.  Data which is written along with the entry
+* (see directMappedCacheBeginStore) may be read until directMappedCacheEndLookup is called.
+* @param cache
+* @param owner
+* @param key
+* @param value receives the cached value if the entry matches
+* @param sequence receives the sequence number to pass to directMappedCacheEndLookup
+* @return the entry if it matches owner and key in the current generation, NULL otherwise
+*/
+J9DirectMappedCacheEntry *
+directMappedCacheBeginLookup(J9DirectMappedCache *cache, void *owner, UDATA key, UDATA *value, UDATA *sequence);
+
+/**
+* @brief Finish reading an entry returned by directMappedCacheBeginLookup.
+* @param entry
+* @param sequence
+* @return TRUE if the entry was not written while it was being read, FALSE if the values read must be discarded
+*/
+BOOLEAN
+directMappedCacheEndLookup(J9DirectMappedCacheEntry *entry, UDATA sequence);
+
+/**
+* @brief Claim the entry for owner and key so that it can be written.
+* @param cache
+* @param owner
+* @param key
+* @param sequence receives the sequence number to pass to directMappedCacheEndStore
+* @return the entry, or NULL if another thread is writing it
+*/
+J9DirectMappedCacheEntry *
+directMappedCacheBeginStore(J9DirectMappedCache *cache, void *owner, UDATA key, UDATA *sequence);
+
+/**
+* @brief Write and release an entry claimed by directMappedCacheBeginStore.
+* @param entry
+* @param owner
+* @param key
+* @param generation the value of cache->generation read before the value was computed
+* @param value
+* @param sequence
+* @return Void.
+*/
+void
+directMappedCacheEndStore(J9DirectMappedCacheEntry *entry, void *owner, UDATA key, UDATA generation, UDATA value, UDATA sequence);
+
+/**
+* @brief Find a cached value.
+* @param cache
+* @param owner
+* @param key
+* @param value receives the value on a hit
+* @return TRUE on a hit, FALSE otherwise
+*/
+BOOLEAN
+directMappedCacheLookup(J9DirectMappedCache *cache, void *owner, UDATA key, UDATA *value);
+
+/**
+* @brief Record a value in the cache.  Does nothing if another thread is updating the same entry.
+* @param cache
+* @param owner
+* @param key
+* @param generation the value of cache->generation read before the value was computed
+* @param value
+* @return Void.
+*/
+void
+directMappedCacheStore(J9DirectMappedCache *cache, void *owner, UDATA key, UDATA generation, UDATA value);
+
+/**
+* @brief Add the lookups made by one caller to the cache statistics.
+* @param cache
+* @param hits
+* @param misses
+* @return Void.
+*/
+void
+directMappedCacheRecordLookups(J9DirectMappedCache *cache, UDATA hits, UDATA misses);
+
+
 /* ---------------- divhelp.c ---------------- */
 
 /**
@@ -1308,6 +1416,24 @@ void validateLibrary(J9JavaVM *javaVM, J9NativeLibrary *library);
 UDATA
 getLineNumberForROMClassFromROMMethod(J9JavaVM *vm, J9ROMMethod *romMethod, J9ROMClass *romClass, UDATA offset, J9ClassLoader *classLoader, UDATA relativePC);
 
+/* The number of entries in vm->lineNumberCache, which must be a power of two */
+#define J9_LINENUMBER_CACHE_SIZE 4096
+
+/**
+* @brief Same as getLineNumberForROMClassFromROMMethod, but remembers the result in vm->lineNumberCache
+* so that the line number table of the method is not decoded again for the same PC.
+* @param vm
+* @param romMethod
+* @param romClass
+* @param offset
+* @param classLoader
+* @param relativePC
+* @return the line number, or (UDATA)-1 if it is not known
+* @note Assumes VM access, so that romMethod cannot be unloaded while it is cached
+*/
+UDATA
+getCachedLineNumberForROMMethod(J9JavaVM *vm, J9ROMMethod *romMethod, J9ROMClass *romClass, UDATA offset, J9ClassLoader *classLoader, UDATA relativePC);
+
 /**
 * @brief
 * @param *romMethod
@@ -24,12 +24,39 @@
 #include <string.h>
 #include "FileStream.hpp"
 #include "../oti/util_api.h"
+#include "j9cfg.h"
+
+#if defined(J9VM_OPT_ZLIB_SUPPORT)
+#include "zlib.h"
+
+/* Size of each of the uncompressed staging and compressed output buffers */
+#define DEFLATE_BUFFER_SIZE (128 * 1024)
+
+static voidpf
+deflateAlloc(voidpf opaque, uInt items, uInt size)
+{
+	PORT_ACCESS_FROM_PORT((J9PortLibrary*)opaque);
+
+	return j9mem_allocate_memory(items * size, OMRMEM_CATEGORY_VM);
+}
+
+static void
+deflateFree(voidpf opaque, voidpf address)
+{
+	PORT_ACCESS_FROM_PORT((J9PortLibrary*)opaque);
+
+	j9mem_free_memory(address);
+}
+#endif /* J9VM_OPT_ZLIB_SUPPORT */
 
 /* Constructor */
 FileStream::FileStream(J9PortLibrary* portLibrary) :
 	_PortLibrary(portLibrary),
 	_FileHandle(-1),
-	_Error(0)
+	_Error(0),
+	_Deflater(NULL),
+	_DeflateBuffer(NULL),
+	_DeflateInputLength(0)
 {
 	/* Nothing to do */
 }
@@ -42,11 +69,15 @@ FileStream::~FileStream()
 
 /* Method for opening the file */
 void
-FileStream::open(const char* fileName)
+FileStream::open(const char* fileName, bool compress)
 {
 	if (fileName[0] != '-' ) {
 		_FileHandle = j9cached_file_open(_PortLibrary, fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate | EsOpenCreateNoTag, 0666);
 		_Error = 0;
+
+		if (compress && (_FileHandle != -1)) {
+			openDeflater();
+		}
 	}
 }
 
@@ -55,6 +86,7 @@ void
 FileStream::close(void)
 {
 	if (_FileHandle != -1) {
+		closeDeflater();
 		j9cached_file_sync(_PortLibrary, _FileHandle);
 		j9cached_file_close(_PortLibrary, _FileHandle);
 	}
@@ -78,6 +110,28 @@ void
 FileStream::writeCharacters(const char* data, IDATA length)
 {
 	if (_FileHandle != -1 && ! _Error) {
+#if defined(J9VM_OPT_ZLIB_SUPPORT)
+		if (NULL != _Deflater) {
+			/* Stage the data so that the compressor is handed large blocks rather than single fields */
+			while ((length > 0) && ! _Error) {
+				IDATA chunk = DEFLATE_BUFFER_SIZE - _DeflateInputLength;
+
+				if (chunk > length) {
+					chunk = length;
+				}
+				memcpy(_DeflateBuffer + _DeflateInputLength, data, chunk);
+				_DeflateInputLength += chunk;
+				data += chunk;
+				length -= chunk;
+
+				if (DEFLATE_BUFFER_SIZE == _DeflateInputLength) {
+					deflateToFile(Z_NO_FLUSH);
+				}
+			}
+			return;
+		}
+#endif /* J9VM_OPT_ZLIB_SUPPORT */
+
 		IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
 
 		if (rc != length) {
@@ -111,3 +165,97 @@ FileStream::writeNumber(IDATA data, int length)
 	/* Write the data to the file */
 	writeCharacters(buffer, length);
 }
+
+/* Method for starting gzip compression of the data written to the file */
+void
+FileStream::openDeflater(void)
+{
+#if defined(J9VM_OPT_ZLIB_SUPPORT)
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	z_stream* stream = (z_stream*)j9mem_allocate_memory(sizeof(z_stream), OMRMEM_CATEGORY_VM);
+	char* buffer = (char*)j9mem_allocate_memory(2 * DEFLATE_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+
+	if ((NULL != stream) && (NULL != buffer)) {
+		memset(stream, 0, sizeof(z_stream));
+		stream->zalloc = deflateAlloc;
+		stream->zfree = deflateFree;
+		stream->opaque = (voidpf)_PortLibrary;
+
+		/* Favour speed over ratio: the point is to get the dump off the machine sooner. Adding 16 to the
+		 * window bits asks for a gzip header and trailer so that the file can be read with standard tools.
+		 */
+		if (Z_OK == deflateInit2(stream, Z_BEST_SPEED, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY)) {
+			_Deflater = stream;
+			_DeflateBuffer = buffer;
+			_DeflateInputLength = 0;
+			return;
+		}
+	}
+
+	j9mem_free_memory(buffer);
+	j9mem_free_memory(stream);
+#endif /* J9VM_OPT_ZLIB_SUPPORT */
+
+	/* The file name promises compressed content, so fail rather than silently write it uncompressed */
+	_Error = -1;
+}
+
+/* Method for flushing any staged data and completing the gzip stream */
+void
+FileStream::closeDeflater(void)
+{
+#if defined(J9VM_OPT_ZLIB_SUPPORT)
+	if (NULL != _Deflater) {
+		PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+		if (! _Error) {
+			deflateToFile(Z_FINISH);
+		}
+		deflateEnd((z_stream*)_Deflater);
+		j9mem_free_memory(_Deflater);
+		j9mem_free_memory(_DeflateBuffer);
+
+		_Deflater = NULL;
+		_DeflateBuffer = NULL;
+		_DeflateInputLength = 0;
+	}
+#endif /* J9VM_OPT_ZLIB_SUPPORT */
+}
+
+/* Method for compressing the staged data and writing out the result */
+void
+FileStream::deflateToFile(int flush)
+{
+#if defined(J9VM_OPT_ZLIB_SUPPORT)
+	z_stream* stream = (z_stream*)_Deflater;
+	char* output = _DeflateBuffer + DEFLATE_BUFFER_SIZE;
+	int rc = Z_OK;
+
+	stream->next_in = (Bytef*)_DeflateBuffer;
+	stream->avail_in = (uInt)_DeflateInputLength;
+
+	/* Keep going while the compressor fills the output buffer, or until the stream is complete when finishing */
+	do {
+		stream->next_out = (Bytef*)output;
+		stream->avail_out = DEFLATE_BUFFER_SIZE;
+
+		rc = deflate(stream, flush);
+		if (Z_STREAM_ERROR == rc) {
+			_Error = -1;
+			return;
+		}
+
+		IDATA pending = DEFLATE_BUFFER_SIZE - stream->avail_out;
+		if (pending > 0) {
+			IDATA written = j9cached_file_write(_PortLibrary, _FileHandle, output, pending);
+
+			if (written != pending) {
+				_Error = (written < 0) ? written : -1;
+				return;
+			}
+		}
+	} while ((0 == stream->avail_out) || ((Z_FINISH == flush) && (Z_STREAM_END != rc)));
+
+	_DeflateInputLength = 0;
+#endif /* J9VM_OPT_ZLIB_SUPPORT */
+}
@@ -39,8 +39,8 @@ public :
 	/* Destructor */
 	~FileStream();
 
-	/* Method for opening the file */
-	void open(const char* fileName);
+	/* Method for opening the file, optionally gzip compressing everything written to it */
+	void open(const char* fileName, bool compress = false);
 
 	/* Method for closing the file */
 	void close(void);
@@ -59,11 +59,19 @@ private :
 	FileStream(const FileStream& source);
 	FileStream& operator=(const FileStream& source);
 
+	/* Methods for streaming data through the compressor */
+	void openDeflater(void);
+	void closeDeflater(void);
+	void deflateToFile(int flush);
+
 protected :
 	/* Declared data */
 	J9PortLibrary* _PortLibrary;
 	IDATA          _FileHandle;
 	IDATA          _Error;
+	void*          _Deflater;
+	char*          _DeflateBuffer;
+	UDATA          _DeflateInputLength;
 };
 
 #endif
@@ -166,7 +166,8 @@ static const J9RASdumpRequest rasDumpRequests[] =
 	{ "prepwalk",  "DO_PREPARE_HEAP_FOR_WALK",   J9RAS_DUMP_DO_PREPARE_HEAP_FOR_WALK },
 	{ "serial",    "DO_SUSPEND_OTHER_DUMPS",     J9RAS_DUMP_DO_SUSPEND_OTHER_DUMPS },
 	{ "attach",    "DO_ATTACH_THREAD",           J9RAS_DUMP_DO_ATTACH_THREAD },
-	{ "preempt",   "DO_PREEMPT_THREADS",         J9RAS_DUMP_DO_PREEMPT_THREADS }
+	{ "preempt",   "DO_PREEMPT_THREADS",         J9RAS_DUMP_DO_PREEMPT_THREADS },
+	{ "perthread", "DO_HALT_PER_THREAD",         J9RAS_DUMP_DO_HALT_PER_THREAD }
 };
 
 #define J9RAS_DUMP_KNOWN_REQUESTS  ( sizeof(rasDumpRequests) / sizeof(J9RASdumpRequest) )
@@ -1822,7 +1823,7 @@ printDumpSpec(struct J9JavaVM *vm, IDATA kind, IDATA verboseLevel)
 					"        [+<name>...]     (see -Xdump:request)\n");
 
 				if (strcmp(spec->name, "heap") == 0) {
-					j9tty_err_printf(PORTLIB, "\n  opts=PHD|CLASSIC\n");
+					j9tty_err_printf(PORTLIB, "\n  opts=PHD|CLASSIC[+GZIP]\n");
 				} else if (strcmp(spec->name, "tool") == 0) {
 					j9tty_err_printf(PORTLIB, "\n  opts=WAIT<msec>|ASYNC\n");
 #ifdef J9ZOS390
@@ -2773,6 +2774,10 @@ runDumpAgent(struct J9JavaVM *vm, J9RASdumpAgent * agent, J9RASdumpContext * con
 				if (agent->dumpFn == doHeapDump) {
 					if (agent->dumpOptions && strstr(agent->dumpOptions, "PHD")) {
 						writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), label);
+						if (strstr(agent->dumpOptions, "GZIP")) {
+							/* the PHD writer appends the suffix when compressing, see BinaryHeapDumpWriter */
+							writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), ".gz");
+						}
 						writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), "\t");
 					}
 
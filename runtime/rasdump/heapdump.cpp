@@ -771,6 +771,7 @@ private :
 		IDATA maximumOffset (void) const;
 		UDATA count         (void) const;
 		IDATA offset        (UDATA index) const;
+		bool  allRecorded   (void) const;
 
 		BinaryHeapDumpWriter* _HeapDumpWriter;
 
@@ -784,7 +785,10 @@ private :
 		IDATA                 _MaximumOffset;
 		IDATA                 _MinimumOffset;
 		UDATA                 _Count;
-		IDATA                 _Offsets[8];
+		IDATA*                _Offsets;
+		UDATA                 _Capacity;
+		bool                  _Overflow;
+		IDATA                 _InlineOffsets[8];
 	};
 
 	/* Nested class for writing a reference to the file */
@@ -856,6 +860,7 @@ private :
 	static int       numberSizeEncoding(int numberSize);
 	static int       wordSize(void);
 	void             checkForIOError(void);
+	IDATA*           growReferenceOffsets(UDATA count);
 	/* Methods for writing data to output file (proxies to _OutputStream */
 	void             writeCharacters (const char* data, IDATA length);
 	void             writeCharacters (const char* data);
@@ -871,12 +876,17 @@ private :
 	FileStream        _OutputStream;
 	void*             _CurrentObject;
 	ClassCache        _ClassCache;
+	IDATA*            _ReferenceOffsets;
+	UDATA             _ReferenceOffsetsCapacity;
+	bool              _Compress;
 	bool              _FileMode;
 	bool              _Error;
 
 	/* Static methods returning constant values */
 	inline static const char* identifierField(void)        {return "portable heap dump";}
 	inline static char        versionField(void)           {return 0x06;}
+	/* Upper bound on the entries of the shared reference offsets buffer; objects with more references are rescanned */
+	inline static UDATA       maximumReferenceOffsets(void) {return 64 * 1024;}
 
 #if defined(J9VM_OPT_NEW_OBJECT_HASH)
 	inline static char        primaryFlagsField(void)
@@ -922,7 +932,10 @@ BinaryHeapDumpWriter::ReferenceTraits::ReferenceTraits(
 	_ObjectAddress(objectAddress),
 	_MaximumOffset(0),
 	_MinimumOffset(0),
-	_Count(0)
+	_Count(0),
+	_Offsets(_InlineOffsets),
+	_Capacity(8),
+	_Overflow(false)
 {
 }
 
@@ -951,8 +964,22 @@ BinaryHeapDumpWriter::ReferenceTraits::addReference(j9object_t objectReference)
 		_MinimumOffset = offset;
 	}
 
-	/* Remember the first few offsets */
-	if (_Count < 8) {
+	/* Remember the offsets, moving to the writer's shared buffer once the inline ones are used up */
+	if (!_Overflow && (_Count == _Capacity)) {
+		IDATA* offsets = _HeapDumpWriter->growReferenceOffsets(2 * _Capacity);
+		if (NULL == offsets) {
+			/* Too many references to remember; keep counting and the writer will rescan the object instead */
+			_Overflow = true;
+		} else {
+			if (_Offsets == _InlineOffsets) {
+				memcpy(offsets, _InlineOffsets, sizeof(_InlineOffsets));
+			}
+			_Offsets  = offsets;
+			_Capacity = 2 * _Capacity;
+		}
+	}
+
+	if (!_Overflow) {
 		_Offsets[_Count] = offset;
 	}
 
@@ -994,13 +1021,24 @@ BinaryHeapDumpWriter::ReferenceTraits::count(void) const
 IDATA
 BinaryHeapDumpWriter::ReferenceTraits::offset(UDATA index) const
 {
-	if (index > 8) {
+	if ((index >= _Count) || (index >= _Capacity)) {
 		return 0;
 	}
 	
 	return _Offsets[index];
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::ReferenceTraits::allRecorded() method implementation                     */
+/*                                                                                                */
+/**************************************************************************************************/
+bool
+BinaryHeapDumpWriter::ReferenceTraits::allRecorded(void) const
+{
+	return !_Overflow;
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::ReferenceWriter::ReferenceWriter() method implementation                 */
@@ -1123,6 +1161,9 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	_FileName(context->javaVM->portLibrary),
 	_OutputStream(context->javaVM->portLibrary),
 	_CurrentObject(0),
+	_ReferenceOffsets(NULL),
+	_ReferenceOffsetsCapacity(0),
+	_Compress(false),
 	_FileMode(false),
 	_Error(false)
 {
@@ -1133,16 +1174,20 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		return;
 	}
 	
-	/* Remember the file name */
+	/* Remember the file name, noting the compression in it if the output is to be compressed */
 	_FileName += fileName;
+	_Compress = (agent->dumpOptions != 0) && (strstr(agent->dumpOptions, "GZIP") != 0);
+	if (_Compress) {
+		_FileName += ".gz";
+	}
 	
 	/* Handle the cases of multiple dump files and a single dump file separately */
 	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) {
 		/* Write a message to standard error saying we are about to write a dump file */
-		reportDumpRequest(_PortLibrary,_Context,"Heap",fileName);
+		reportDumpRequest(_PortLibrary,_Context,"Heap",_FileName.data());
 		
 		/* It's a single file so open it */
-		_OutputStream.open(_FileName.data());
+		_OutputStream.open(_FileName.data(), _Compress);
 	
 		/* Performance measuring code 
 		startTimer();
@@ -1176,11 +1221,11 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
 		if (! _Error) {
 			if (_FileMode) {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			} else {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			}
 		}
 	}
@@ -1193,7 +1238,43 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 /**************************************************************************************************/
 BinaryHeapDumpWriter::~BinaryHeapDumpWriter()
 {
-	/* Nothing to do currently */
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	/* Release the reference offset buffer */
+	j9mem_free_memory(_ReferenceOffsets);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::growReferenceOffsets() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+IDATA*
+BinaryHeapDumpWriter::growReferenceOffsets(UDATA count)
+{
+	/* The buffer is shared by successive objects, so it only ever grows. Its current contents
+	 * are preserved so that the reference traits object using it can carry on appending.
+	 * Heap dumps are often taken when memory is short, so the buffer is capped rather than
+	 * sized to the largest object array.
+	 */
+	if (count > maximumReferenceOffsets()) {
+		return NULL;
+	}
+	if (count > _ReferenceOffsetsCapacity) {
+		PORT_ACCESS_FROM_PORT(_PortLibrary);
+		IDATA* offsets = (IDATA*)j9mem_allocate_memory(count * sizeof(IDATA), OMRMEM_CATEGORY_VM);
+		if (NULL == offsets) {
+			return NULL;
+		}
+		if (NULL != _ReferenceOffsets) {
+			memcpy(offsets, _ReferenceOffsets, _ReferenceOffsetsCapacity * sizeof(IDATA));
+			j9mem_free_memory(_ReferenceOffsets);
+		}
+		_ReferenceOffsets         = offsets;
+		_ReferenceOffsetsCapacity = count;
+	}
+
+	return _ReferenceOffsets;
 }
 
 /**************************************************************************************************/
@@ -1227,7 +1308,7 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		_ClassCache.clear();
 
 		/* Open the file */
-		_OutputStream.open(fileName.data());
+		_OutputStream.open(fileName.data(), _Compress);
 
 		/* Start writing the file */
 		writeDumpFileHeader();
@@ -1601,16 +1682,27 @@ BinaryHeapDumpWriter::writeNormalObjectRecord(J9MM_IterateObjectDescriptor* obje
 		}
 
 		/* Write the references */
-		ReferenceWriter referenceWriter(this, currentObject, referenceTraits.count(), referenceOffsetSize);
+		if (referenceTraits.allRecorded()) {
+			/* The references are already stored so just output them */
+			for (UDATA i = 0; i < referenceTraits.count(); i++) {
+				writeNumber(referenceTraits.offset(i) / 4, referenceOffsetSize);
+				if (_Error) {
+					return;
+				}
+			}
+		} else {
+			/* There were too many references to remember so scan the object again */
+			ReferenceWriter referenceWriter(this, currentObject, referenceTraits.count(), referenceOffsetSize);
 
-		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_object_slots(
-			_VirtualMachine,
-			_PortLibrary,
-			objectDescriptor,
-			j9mm_iterator_flag_exclude_null_refs,
-			binaryHeapDumpObjectReferenceIteratorWriterCallback,
-			&referenceWriter
-		);
+			_VirtualMachine->memoryManagerFunctions->j9mm_iterate_object_slots(
+				_VirtualMachine,
+				_PortLibrary,
+				objectDescriptor,
+				j9mm_iterator_flag_exclude_null_refs,
+				binaryHeapDumpObjectReferenceIteratorWriterCallback,
+				&referenceWriter
+			);
+		}
 
 		/* Now that the class has been described, add it to the class cache */
 		_ClassCache.add(objectClassAddress);
@@ -1854,7 +1946,7 @@ BinaryHeapDumpWriter::writeArrayObjectRecord(J9MM_IterateObjectDescriptor* objec
 			}
 
 			/* Write the reference offsets */
-			if (referenceTraits.count() <= 7) {
+			if (referenceTraits.allRecorded()) {
 				/* The references are already stored so just output them */
 				for (UDATA i = 0; i < referenceTraits.count(); i++) {
 					writeNumber(referenceTraits.offset(i) / 4, referenceOffsetSize);
@@ -282,6 +282,7 @@ private :
 	void writeSharedClassLockInfo(const char* lockName, IDATA lockSemid, void* lockTID);
 	void writeSharedClassSection(void);
 #endif
+	void writeMethodSampleSection(void);
 	void writeTrailer(void);
 
 	/* Internal methods for writing the nested sections */
@@ -321,6 +322,9 @@ private :
 	void        writeHookInfo                (struct OMRHookInfo4Dump *hookInfo);
 	void        writeHookInterface           (struct J9HookInterface **hookInterface);
 	/* Other internal methods */
+	UDATA       enterHaltPerThreadMode       (void);
+	void        exitHaltPerThreadMode        (UDATA accessState);
+	J9VMThread* pinNextThread                (J9VMThread *pinnedThread, bool restart);
 	j9object_t getClassLoaderObject(J9ClassLoader* loader);
 	UDATA createPadding(const char* str, UDATA fieldWidth, char padChar, char* buffer);
 	void writeThreadState(UDATA threadState);
@@ -337,6 +341,9 @@ private :
 	bool              _AvoidLocks;
 	bool              _PreemptLocked;
 	bool              _ThreadsWalkStarted;
+	bool              _HaltPerThread;
+	J9VMThread*       _HaltedThread;
+	J9VMThread*       _PinnedThread;
 	J9RASdumpAgent *  _Agent;
 	memcategory_data_frame* _CategoryStack;
 	U_32              _CategoryStackTop;
@@ -419,6 +426,9 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	_AvoidLocks(false),
 	_PreemptLocked(false),
 	_ThreadsWalkStarted(false),
+	_HaltPerThread(false),
+	_HaltedThread(NULL),
+	_PinnedThread(NULL),
 	_Agent(agent),
 	_TotalCategories(-1)
 {
@@ -507,6 +517,7 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	CALL_PROTECT(writeSharedClassSection, _Error);
 #endif
 	CALL_PROTECT(writeClassSection, _Error);
+	CALL_PROTECT(writeMethodSampleSection, _Error);
 	CALL_PROTECT(writeTrailer, _Error);
 
 	/* Record the status of the operation */
@@ -687,8 +698,16 @@ JavaCoreDumpWriter::writeTitleSection(void)
 			}
 		}
 
+		moreRequests = moreRequests >> 1;
 		if ((_Agent->requestMask & J9RAS_DUMP_DO_PREEMPT_THREADS) == J9RAS_DUMP_DO_PREEMPT_THREADS) {
 			_OutputStream.writeCharacters("preempt");
+			if (moreRequests) {
+				_OutputStream.writeCharacters("+");
+			}
+		}
+
+		if ((_Agent->requestMask & J9RAS_DUMP_DO_HALT_PER_THREAD) == J9RAS_DUMP_DO_HALT_PER_THREAD) {
+			_OutputStream.writeCharacters("perthread");
 		}
 
 		_OutputStream.writeCharacters(")");
@@ -1860,12 +1879,23 @@ JavaCoreDumpWriter::writeThreadSection(void)
 	if( !_ThreadsWalkStarted ) {
 		struct walkClosure closure;
 		UDATA sink = 0;
+		UDATA haltAccessState = 0;
 		closure.jcw = this;
 		closure.state = NULL;
+
+		/* If request=perthread, halt each thread only while its own stack is walked */
+		if (_Agent->requestMask & J9RAS_DUMP_DO_HALT_PER_THREAD) {
+			haltAccessState = enterHaltPerThreadMode();
+		}
+
 		j9sig_protect(protectedWriteThreadsJavaOnly,
 				&closure, handlerWriteStacks, this,
 				J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN,
 				&sink);
+
+		if (_HaltPerThread) {
+			exitHaltPerThreadMode(haltAccessState);
+		}
 	}
 
 	if ((_Agent->requestMask & J9RAS_DUMP_DO_PREEMPT_THREADS) && (_PreemptLocked == false) ) {
@@ -2320,6 +2350,13 @@ JavaCoreDumpWriter::writeThreadsJavaOnly(void)
 		currentThread = vmThread;
 	}
 
+	if (_HaltPerThread) {
+		_OutputStream.writeCharacters(
+			"NULL           \n"
+			"1XMWLKTHDINF   Threads halted individually while their stacks were collected\n"
+		);
+	}
+
 	/** Write the current thread out (if appropriate) **/
     if ( currentThread != NULL) {
 		j9object_t lockObject;
@@ -2360,7 +2397,13 @@ JavaCoreDumpWriter::writeThreadsJavaOnly(void)
     }
 
 	/* dump the java stacks for all threads*/
-	J9VMThread* walkThread = J9_LINKED_LIST_START_DO(_VirtualMachine->mainThread);
+	J9VMThread* walkThread = NULL;
+	if (_HaltPerThread) {
+		/* Halting releases VM access, so each thread is pinned to stop it from exiting while it is written */
+		walkThread = pinNextThread(NULL, true);
+	} else {
+		walkThread = J9_LINKED_LIST_START_DO(_VirtualMachine->mainThread);
+	}
 	for (UDATA i = 0; walkThread != NULL && i < _AllocatedVMThreadCount; i++) {
 		j9object_t lockObject;
 		J9VMThread *lockOwner;
@@ -2373,6 +2416,14 @@ JavaCoreDumpWriter::writeThreadsJavaOnly(void)
 
 		/* If we have a current thread it will already have been written. */
 		if( walkThread != currentThread ) {
+			if (_HaltPerThread) {
+				/* Stop this thread only while its state and stack are collected. Halting may release and
+				 * reacquire VM access, so no object pointers are carried over from the previous thread.
+				 */
+				_HaltedThread = walkThread;
+				_VirtualMachine->internalVMFunctions->haltThreadForInspection(vmThread, walkThread);
+			}
+
 			/* Obtain java state through getVMThreadObjectState() for outputting to javacore */
 			if (J9PORT_SIG_EXCEPTION_OCCURRED == j9sig_protect(protectedGetVMThreadObjectState, args, handlerGetVMThreadObjectState, &stateFault, J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN, &stateClean)) {
 				javaThreadState = J9VMTHREAD_STATE_UNREADABLE;
@@ -2397,13 +2448,27 @@ JavaCoreDumpWriter::writeThreadsJavaOnly(void)
 				);
 			}
 			writeThread(walkThread, NULL, vmThreadState, javaThreadState, javaPriority, lockObject, lockOwner);
+
+			if (NULL != _HaltedThread) {
+				_VirtualMachine->internalVMFunctions->resumeThreadForInspection(vmThread, _HaltedThread);
+				_HaltedThread = NULL;
+			}
 		}
 
-		walkThread = J9_LINKED_LIST_NEXT_DO(_VirtualMachine->mainThread, walkThread);
+		if (_HaltPerThread) {
+			/* the next thread is found while the current one is still pinned, so it is still linked */
+			walkThread = pinNextThread(walkThread, false);
+		} else {
+			walkThread = J9_LINKED_LIST_NEXT_DO(_VirtualMachine->mainThread, walkThread);
+		}
 		if (walkThread != NULL && walkThread->publicFlags == J9_PUBLIC_FLAGS_HALT_THREAD_INSPECTION) {
 			/* restart the walk */
 			if (!restartedWalk) {
-				walkThread = J9_LINKED_LIST_START_DO(_VirtualMachine->mainThread);
+				if (_HaltPerThread) {
+					walkThread = pinNextThread(walkThread, true);
+				} else {
+					walkThread = J9_LINKED_LIST_START_DO(_VirtualMachine->mainThread);
+				}
 				i = 0;
 				restartedWalk = 1;
 				continue;
@@ -2416,6 +2481,116 @@ JavaCoreDumpWriter::writeThreadsJavaOnly(void)
 	_OutputStream.writeCharacters("NULL           ------------------------------------------------------------------------\n");
 }
 
+/**
+ * Prepare to halt Java threads one at a time for request=perthread. The dumping thread needs VM access
+ * to halt another thread, so it is acquired here if the dump is not already running with exclusive
+ * access. Dumps whose thread already held VM access when the event fired are not eligible, as halting
+ * releases VM access and the event may hold direct object pointers across the dump.
+ *
+ * @return the J9RAS_DUMP_GOT_* flags for the access acquired, to be passed to exitHaltPerThreadMode()
+ */
+UDATA
+JavaCoreDumpWriter::enterHaltPerThreadMode(void)
+{
+	J9VMThread *vmThread = _Context->onThread;
+	UDATA accessState = 0;
+
+	if ((NULL == vmThread)
+		|| (_Agent->prepState & J9RAS_DUMP_GOT_EXCLUSIVE_VM_ACCESS)
+		|| (_Context->eventFlags & (J9RAS_DUMP_ON_GP_FAULT | J9RAS_DUMP_ON_ABORT_SIGNAL | J9RAS_DUMP_ON_TRACE_ASSERT))
+		|| (J9_XACCESS_NONE != _VirtualMachine->exclusiveAccessState)
+	) {
+		return 0;
+	}
+
+#if defined(J9VM_INTERP_ATOMIC_FREE_JNI)
+	if (vmThread->inNative) {
+		_VirtualMachine->internalVMFunctions->internalEnterVMFromJNI(vmThread);
+		accessState = J9RAS_DUMP_GOT_JNI_VM_ACCESS;
+	} else
+#endif /* J9VM_INTERP_ATOMIC_FREE_JNI */
+	if ((vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS) == 0) {
+		_VirtualMachine->internalVMFunctions->internalAcquireVMAccess(vmThread);
+		accessState = J9RAS_DUMP_GOT_VM_ACCESS;
+	}
+
+	_HaltPerThread = (0 != accessState);
+
+	return accessState;
+}
+
+/**
+ * Resume any thread left halted by a failed stack walk and release the VM access taken by
+ * enterHaltPerThreadMode().
+ *
+ * @param accessState[in] the value returned by enterHaltPerThreadMode()
+ */
+void
+JavaCoreDumpWriter::exitHaltPerThreadMode(UDATA accessState)
+{
+	J9VMThread *vmThread = _Context->onThread;
+
+	if (NULL != _HaltedThread) {
+		_VirtualMachine->internalVMFunctions->resumeThreadForInspection(vmThread, _HaltedThread);
+		_HaltedThread = NULL;
+	}
+
+	/* Allow the thread pinned by a failed or abandoned walk to exit */
+	if (NULL != _PinnedThread) {
+		omrthread_monitor_enter(_VirtualMachine->vmThreadListMutex);
+		if (0 == --(_PinnedThread->inspectorCount)) {
+			omrthread_monitor_notify_all(_VirtualMachine->vmThreadListMutex);
+		}
+		omrthread_monitor_exit(_VirtualMachine->vmThreadListMutex);
+		_PinnedThread = NULL;
+	}
+
+#if defined(J9VM_INTERP_ATOMIC_FREE_JNI)
+	if (accessState & J9RAS_DUMP_GOT_JNI_VM_ACCESS) {
+		_VirtualMachine->internalVMFunctions->internalExitVMToJNI(vmThread);
+	} else
+#endif /* J9VM_INTERP_ATOMIC_FREE_JNI */
+	if (accessState & J9RAS_DUMP_GOT_VM_ACCESS) {
+		_VirtualMachine->internalVMFunctions->internalReleaseVMAccess(vmThread);
+	}
+
+	_HaltPerThread = false;
+}
+
+/**
+ * Move the pin used by request=perthread to the next thread in the VM thread list. A pinned thread
+ * cannot exit (see threadCleanup()), so it remains linked and its J9VMThread remains valid while it is
+ * halted and written, even though halting releases the dumping thread's VM access.
+ *
+ * @param pinnedThread[in] the currently pinned thread, or NULL
+ * @param restart[in] true to pin the first thread in the list, false to pin the successor of pinnedThread
+ * @return the newly pinned thread, or NULL at the end of the list
+ */
+J9VMThread *
+JavaCoreDumpWriter::pinNextThread(J9VMThread *pinnedThread, bool restart)
+{
+	J9VMThread *nextThread = NULL;
+
+	omrthread_monitor_enter(_VirtualMachine->vmThreadListMutex);
+	if (restart) {
+		nextThread = J9_LINKED_LIST_START_DO(_VirtualMachine->mainThread);
+	} else {
+		nextThread = J9_LINKED_LIST_NEXT_DO(_VirtualMachine->mainThread, pinnedThread);
+	}
+	if (NULL != nextThread) {
+		++(nextThread->inspectorCount);
+	}
+	if (NULL != pinnedThread) {
+		if (0 == --(pinnedThread->inspectorCount)) {
+			omrthread_monitor_notify_all(_VirtualMachine->vmThreadListMutex);
+		}
+	}
+	omrthread_monitor_exit(_VirtualMachine->vmThreadListMutex);
+
+	_PinnedThread = nextThread;
+	return nextThread;
+}
+
 
 /**************************************************************************************************/
 /*                                                                                                */
@@ -2455,6 +2630,82 @@ JavaCoreDumpWriter::writeClassSection(void)
 	);
 }
 
+/**
+ * JavaCoreDumpWriter::writeMethodSampleSection() method implementation
+ *
+ * Lists the most frequently entered methods counted by -Xtrace:methodsample=nn.
+ * The section is omitted when method sampling is not enabled.
+ *
+ * 0SECTION       METHODSAMPLE subcomponent dump routine
+ * NULL           ======================================
+ * 1MSINTERVAL    Sampling interval: 1000
+ * 1MSHOTMETHODS  Most frequently entered methods:
+ * 2MSMETHOD      1234567 entries: java/lang/String.hashCode()I
+ * NULL           ------------------------------------------------------------------------
+ */
+void
+JavaCoreDumpWriter::writeMethodSampleSection(void)
+{
+	RasGlobalStorage* j9ras = (RasGlobalStorage*)_VirtualMachine->j9rasGlobalStorage;
+	const UDATA maxMethods = 32;
+	J9Method* topMethods[maxMethods];
+	UDATA topCounts[maxMethods];
+	UDATA topCount = 0;
+	UDATA i = 0;
+
+	if ((NULL == j9ras) || (NULL == j9ras->methodSamples)) {
+		return;
+	}
+
+	/* Select the busiest methods. Counts are updated without locking, so read each one once. */
+	for (i = 0; i < j9ras->methodSampleTableSize; i++) {
+		J9Method* method = j9ras->methodSamples[i].method;
+		UDATA count = j9ras->methodSamples[i].count;
+
+		if ((NULL == method) || (RAS_METHOD_SAMPLE_REMOVED == method) || (0 == count)) {
+			continue;
+		}
+		if ((topCount == maxMethods) && (count <= topCounts[maxMethods - 1])) {
+			continue;
+		}
+
+		UDATA slot = (topCount < maxMethods) ? topCount++ : (maxMethods - 1);
+		while ((slot > 0) && (topCounts[slot - 1] < count)) {
+			topMethods[slot] = topMethods[slot - 1];
+			topCounts[slot] = topCounts[slot - 1];
+			slot -= 1;
+		}
+		topMethods[slot] = method;
+		topCounts[slot] = count;
+	}
+
+	_OutputStream.writeCharacters(
+		"0SECTION       METHODSAMPLE subcomponent dump routine\n"
+		"NULL           ======================================\n"
+		"1MSINTERVAL    Sampling interval: "
+	);
+	_OutputStream.writeInteger(j9ras->methodSampleInterval, "%zu");
+	_OutputStream.writeCharacters("\n1MSHOTMETHODS  Most frequently entered methods:\n");
+
+	for (i = 0; i < topCount; i++) {
+		J9Class* methodClass = J9_CLASS_FROM_METHOD(topMethods[i]);
+		J9ROMMethod* romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(topMethods[i]);
+
+		_OutputStream.writeCharacters("2MSMETHOD      ");
+		_OutputStream.writeInteger(topCounts[i], "%zu");
+		_OutputStream.writeCharacters(" entries: ");
+		_OutputStream.writeCharacters(J9ROMCLASS_CLASSNAME(methodClass->romClass));
+		_OutputStream.writeCharacters(".");
+		_OutputStream.writeCharacters(J9ROMMETHOD_NAME(romMethod));
+		_OutputStream.writeCharacters(J9ROMMETHOD_SIGNATURE(romMethod));
+		_OutputStream.writeCharacters("\n");
+	}
+
+	_OutputStream.writeCharacters(
+		"NULL           ------------------------------------------------------------------------\n"
+	);
+}
+
 /**
  * JavaCoreDumpWriter::writeHookSection() method implementation
  *
@@ -563,8 +563,8 @@ prepareForDump(struct J9JavaVM *vm, struct J9RASdumpAgent *agent, struct J9RASdu
 
 		if ( shareVMAccess == 0 ) {
 
-			/* Deferred attach of SigQuit thread, needed if we're preparing to walk the heap (GC pre-req) */
-			if ( (agent->requestMask & (J9RAS_DUMP_DO_PREPARE_HEAP_FOR_WALK | J9RAS_DUMP_DO_COMPACT_HEAP | J9RAS_DUMP_DO_ATTACH_THREAD)) &&
+			/* Deferred attach of SigQuit thread, needed if we're preparing to walk the heap (GC pre-req) or halting threads one at a time */
+			if ( (agent->requestMask & (J9RAS_DUMP_DO_PREPARE_HEAP_FOR_WALK | J9RAS_DUMP_DO_COMPACT_HEAP | J9RAS_DUMP_DO_ATTACH_THREAD | J9RAS_DUMP_DO_HALT_PER_THREAD)) &&
 			(context->eventFlags & J9RAS_DUMP_ON_USER_SIGNAL ) ) {
 
 				JavaVMAttachArgs attachArgs;
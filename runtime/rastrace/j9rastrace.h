@@ -54,6 +54,7 @@ extern "C" {
 #define RAS_STACKDEPTH_KEYWORD          "STACKDEPTH"
 #define RAS_SLEEPTIME_KEYWORD           "SLEEPTIME"
 #define RAS_COMPRESSION_LEVEL_KEYWORD   "STACKCOMPRESSIONLEVEL"
+#define RAS_METHOD_SAMPLE_KEYWORD       "METHODSAMPLE"
 
 /*
  * ======================================================================
@@ -112,6 +113,7 @@ void trcTraceMethodEnter(J9VMThread *thr, J9Method *method, void *receiverAddres
 void trcTraceMethodExit(J9VMThread *thr, J9Method *method, void *exceptionPtr, void *returnValuePtr, UDATA methodType);
 omr_error_t setMethodSpec(J9JavaVM *vm, char * value, J9UTF8 ** utf8Address, int * matchFlag);
 omr_error_t setMethod(J9JavaVM *vm, const char * value, BOOLEAN atRuntime);
+omr_error_t setMethodSample(J9JavaVM *vm, const char * value, BOOLEAN atRuntime);
 U_8 rasSetTriggerTrace(J9VMThread *thr, J9Method *method);
 void rasTriggerMethod(J9VMThread *thr, J9Method *mb, I_32 entry, const TriggerPhase phase);
 BOOLEAN matchMethod (RasMethodTable * methodTable, J9Method *method);
@@ -43,6 +43,14 @@ static void traceMethodArgBoolean (J9VMThread *thr, UDATA* arg0EA, char* cursor,
 static void traceMethodEnter (J9VMThread *thr, J9Method *method, void *receiverAddress, UDATA isCompiled, UDATA doParameters);
 static void traceMethodArgLong (J9VMThread *thr, UDATA* arg0EA, char* cursor, UDATA length);
 static U_8 checkMethod (J9VMThread *thr, J9Method *method);
+static RasMethodSample * findMethodSample (RasGlobalStorage *rasGlobal, J9Method *method);
+static void sampleMethodEnter (J9VMThread *thr, J9Method *method);
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+static void hookClassesUnload(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
+/* Number of methods that can be counted by -Xtrace:methodsample */
+#define RAS_METHOD_SAMPLE_TABLE_SIZE 4096
 
 /**************************************************************************
  * name        - matchMethod
@@ -311,6 +319,166 @@ traceMethodExitX(J9VMThread *thr, J9Method *method, UDATA isCompiled, void* exce
 
 }
 
+/**************************************************************************
+ * name        - findMethodSample
+ * description - Finds, or claims, the sample table entry for a method.
+ *               Entries are claimed with a compare and swap so that no
+ *               lock is needed on the method entry path. The first entry
+ *               retired by class unloading on the probe sequence is
+ *               reused in preference to an empty one.
+ * parameters  - RAS global storage, J9Method pointer
+ * returns     - the entry, or NULL if the table is full
+ *************************************************************************/
+static RasMethodSample *
+findMethodSample(RasGlobalStorage *rasGlobal, J9Method *method)
+{
+	RasMethodSample *samples = rasGlobal->methodSamples;
+	UDATA tableSize = rasGlobal->methodSampleTableSize;
+	UDATA index = (((UDATA)method) >> 3) % tableSize;
+	RasMethodSample *removed = NULL;
+	UDATA probes = 0;
+
+	for (probes = 0; probes < tableSize; probes++) {
+		RasMethodSample *sample = &samples[index];
+		J9Method *current = sample->method;
+
+		if (current == method) {
+			return sample;
+		}
+		if ((RAS_METHOD_SAMPLE_REMOVED == current) && (NULL == removed)) {
+			removed = sample;
+		}
+		if (NULL == current) {
+			/* The method is not in the table, so claim the retired entry if there was one */
+			if (NULL != removed) {
+				current = (J9Method *)compareAndSwapUDATA((uintptr_t *)&removed->method, (uintptr_t)RAS_METHOD_SAMPLE_REMOVED, (uintptr_t)method);
+				if ((RAS_METHOD_SAMPLE_REMOVED == current) || (current == method)) {
+					return removed;
+				}
+			}
+			current = (J9Method *)compareAndSwapUDATA((uintptr_t *)&sample->method, (uintptr_t)NULL, (uintptr_t)method);
+			if ((NULL == current) || (current == method)) {
+				return sample;
+			}
+		}
+		index = (index + 1) % tableSize;
+	}
+	if (NULL != removed) {
+		J9Method *current = (J9Method *)compareAndSwapUDATA((uintptr_t *)&removed->method, (uintptr_t)RAS_METHOD_SAMPLE_REMOVED, (uintptr_t)method);
+		if ((RAS_METHOD_SAMPLE_REMOVED == current) || (current == method)) {
+			return removed;
+		}
+	}
+	return NULL;
+}
+
+/**************************************************************************
+ * name        - sampleMethodEnter
+ * description - Counts an entry to a traced method and, for every nn'th
+ *               entry, records the J9Method in the trace buffer without
+ *               formatting any names. The count is not updated atomically
+ *               so it is approximate when threads race on the same method.
+ * parameters  - thread, J9Method pointer
+ * returns     - none
+ *************************************************************************/
+static void
+sampleMethodEnter(J9VMThread *thr, J9Method *method)
+{
+	RasGlobalStorage *rasGlobal = (RasGlobalStorage *)thr->javaVM->j9rasGlobalStorage;
+	RasMethodSample *sample = findMethodSample(rasGlobal, method);
+
+	if (NULL != sample) {
+		UDATA count = sample->count + 1;
+
+		sample->count = count;
+		if (0 == (count % rasGlobal->methodSampleInterval)) {
+			Trc_MethodSample(thr, method, count);
+		}
+	}
+}
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+/**************************************************************************
+ * name        - hookClassesUnload
+ * description - Retires the sample table entries of methods in classes
+ *               (including anonymous classes) being unloaded. Runs with
+ *               exclusive VM access.
+ * parameters  - standard hook parameters, userData is the J9JavaVM
+ * returns     - none
+ *************************************************************************/
+static void
+hookClassesUnload(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9JavaVM *vm = (J9JavaVM *)userData;
+	RasGlobalStorage *rasGlobal = (RasGlobalStorage *)vm->j9rasGlobalStorage;
+	RasMethodSample *samples = rasGlobal->methodSamples;
+	UDATA i;
+
+	for (i = 0; i < rasGlobal->methodSampleTableSize; i++) {
+		J9Method *method = samples[i].method;
+
+		if ((NULL != method) && (RAS_METHOD_SAMPLE_REMOVED != method)
+			&& J9_ARE_ANY_BITS_SET(J9CLASS_FLAGS(J9_CLASS_FROM_METHOD(method)), J9_JAVA_CLASS_DYING)
+		) {
+			/* Leave a marker rather than NULL so the probe sequences of other entries stay intact */
+			samples[i].method = RAS_METHOD_SAMPLE_REMOVED;
+			samples[i].count = 0;
+		}
+	}
+}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
+/**************************************************************************
+ * name        - setMethodSample
+ * description - Set the method sampling interval and allocate the table
+ *               of method counts.
+ * parameters  - vm, trace options, atRuntime
+ * returns     - JNI return code
+ *************************************************************************/
+omr_error_t
+setMethodSample(J9JavaVM *vm, const char *str, BOOLEAN atRuntime)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	RasGlobalStorage *rasGlobal = (RasGlobalStorage *)vm->j9rasGlobalStorage;
+	int value, length;
+	omr_error_t rc = OMR_ERROR_NONE;
+	const char *p;
+
+	if (getParmNumber(str) != 1) {
+		goto err;
+	}
+
+	p = getPositionalParm(1, str, &length);
+
+	if (length == 0 || length > 7) {
+		goto err;
+	}
+
+	value = decimalString2Int(PORTLIB, p, FALSE, &rc);
+	if ((rc != OMR_ERROR_NONE) || (value <= 0)) {
+		goto err;
+	}
+
+	if (NULL == rasGlobal->methodSamples) {
+		UDATA tableBytes = RAS_METHOD_SAMPLE_TABLE_SIZE * sizeof(RasMethodSample);
+
+		rasGlobal->methodSamples = j9mem_allocate_memory(tableBytes, OMRMEM_CATEGORY_TRACE);
+		if (NULL == rasGlobal->methodSamples) {
+			dbg_err_printf(1, PORTLIB, "<UT> Out of memory allocating method sample table\n");
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		memset(rasGlobal->methodSamples, 0, tableBytes);
+		rasGlobal->methodSampleTableSize = RAS_METHOD_SAMPLE_TABLE_SIZE;
+	}
+
+	rasGlobal->methodSampleInterval = (unsigned int)value;
+	return OMR_ERROR_NONE;
+
+err:
+	vaReportJ9VMCommandLineError(PORTLIB, "methodsample takes an integer value from 1 to 9999999");
+	return OMR_ERROR_INTERNAL;
+}
+
 static void
 hookRAMClassLoad(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
 {
@@ -344,8 +512,12 @@ trcTraceMethodEnter(J9VMThread* thr, J9Method* method, void *receiverAddress, UD
 	}
 
 	if ( 0 != (*mtFlag & J9_RAS_METHOD_TRACING) ) {
-		UDATA doParameters = *mtFlag & J9_RAS_METHOD_TRACE_ARGS;
-		traceMethodEnter(thr, method, receiverAddress, methodType, doParameters);
+		if ( 0 != RAS_GLOBAL(methodSampleInterval) ) {
+			sampleMethodEnter(thr, method);
+		} else {
+			UDATA doParameters = *mtFlag & J9_RAS_METHOD_TRACE_ARGS;
+			traceMethodEnter(thr, method, receiverAddress, methodType, doParameters);
+		}
 	}
 
 	if ( 0 != (*mtFlag & J9_RAS_METHOD_TRIGGERING) ) {
@@ -368,7 +540,8 @@ trcTraceMethodExit(J9VMThread* thr, J9Method* method,  void* exceptionPtr, void
 		rasTriggerMethod(thr, method, FALSE, BEFORE_TRACEPOINT);
 	}
 
-	if ( 0 != (*mtFlag & J9_RAS_METHOD_TRACING) ) {
+	/* In sampling mode only method entries are counted */
+	if ( (0 != (*mtFlag & J9_RAS_METHOD_TRACING)) && (0 == RAS_GLOBAL(methodSampleInterval)) ) {
 		UDATA doParameters = *mtFlag & J9_RAS_METHOD_TRACE_ARGS;
 		if( exceptionPtr ) {
 			traceMethodExitX(thr, method, methodType, exceptionPtr, doParameters);
@@ -397,6 +570,16 @@ enableMethodTraceHooks(J9JavaVM *vm)
 		return OMR_ERROR_INTERNAL;
 	}
 
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	if (NULL != RAS_GLOBAL_FROM_JAVAVM(methodSamples, vm)) {
+		if ((*hook)->J9HookRegisterWithCallSite(hook, J9HOOK_VM_CLASSES_UNLOAD, hookClassesUnload, OMR_GET_CALLSITE(), vm)
+			|| (*hook)->J9HookRegisterWithCallSite(hook, J9HOOK_VM_ANON_CLASSES_UNLOAD, hookClassesUnload, OMR_GET_CALLSITE(), vm)
+		) {
+			return OMR_ERROR_INTERNAL;
+		}
+	}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
 	return OMR_ERROR_NONE;
 }
 
@@ -430,6 +430,7 @@ int32_t             traceGenerations;       /* Number of trace files           *
 int32_t             nextGeneration;         /* Next generation of file         */
 int32_t             exceptTraceWrap;        /* Limit for exception trace file  */
 uint32_t             lostRecords;            /* Lost record counter             */
+volatile uint32_t    wrappedBuffers;         /* In-core buffer wrap counter     */
 int32_t             platformTraceStarted;   /* Platform trace active flag      */
 int32_t             traceDebug;             /* Trace debug level               */
 int32_t             initialSuspendResume;   /* Initial thread suspend count    */
@@ -459,7 +460,7 @@ UtThreadData      *exceptionContext;       /* UtThreadData for last excptn    */
 UtThreadData      *lastPrint;              /* UtThreadData for last print     */
 UtTraceListener   *traceListeners;         /* List of external listeners      */
 UtTraceBuffer     *traceGlobal;            /* Queue of all trace buffers      */
-UtTraceBuffer     *freeQueue;              /* Free buffer queue               */
+UtTraceBuffer * volatile freeQueue;        /* Free buffer queue (lock-free push, pop under freeQueueLock) */
 qQueue             outputQueue;            /* Buffer queue for external trace */
 UtTraceBuffer     *exceptionTrcBuf;        /* Exception trace buffers         */
 UtTraceCfg        *config;                 /* Trace selection cmds link/list  */
@@ -474,7 +475,7 @@ omrthread_monitor_t subscribersLock;			/* Enforces atomicity of updates to the l
 int32_t            traceInCore;            /* If true then we don't queue buffers */
 volatile uint32_t    allocatedTraceBuffers;  /* The number of allocated trace buffers ????*/
 omrthread_monitor_t threadLock;             /* lock for thread stop */
-omrthread_monitor_t freeQueueLock;          /* lock for free queue */
+omrthread_monitor_t freeQueueLock;          /* serializes removal from the free queue */
 UtSubscription    *tracePointSubscribers;  /* Linked list of tracepoint subscribers */
 struct RasTriggerTpidRange *triggerOnTpids;              /* Trace point ranges to fire trigger actions on */
 omrthread_monitor_t         triggerOnTpidsWriteMutex;     /* Write access spin lock. */
@@ -437,12 +437,13 @@ freeBuffers(qMessage *msg)
 			}
 		}
 
-		omrthread_monitor_enter(UT_GLOBAL(freeQueueLock));
-		
-		trcBuf->next = UT_GLOBAL(freeQueue);
-		UT_GLOBAL(freeQueue) = nextBuf;
-
-		omrthread_monitor_exit(UT_GLOBAL(freeQueueLock));
+		/* Pushing onto the free queue does not need freeQueueLock. Only getTrcBuf removes buffers, and
+		 * it does so under the lock, so the head seen here cannot be removed and re-added (ABA) by
+		 * another thread before the swap.
+		 */
+		do {
+			trcBuf->next = UT_GLOBAL(freeQueue);
+		} while (!twCompareAndSwapPtr((uintptr_t *)&UT_GLOBAL(freeQueue), (uintptr_t)trcBuf->next, (uintptr_t)nextBuf));
 	}
 }
 
@@ -912,6 +913,7 @@ getTrcBuf(UtThreadData **thr, UtTraceBuffer * oldBuf, int bufferType)
 			 *  Incore trace mode so reuse existing buffer, wrapping to the top
 			 */
 			trcBuf = oldBuf;
+			UT_ATOMIC_INC((volatile uint32_t*)&UT_GLOBAL(wrappedBuffers));
 
 			goto out;
 
@@ -985,15 +987,15 @@ getTrcBuf(UtThreadData **thr, UtTraceBuffer * oldBuf, int bufferType)
 	}
 
 	/*
-	 * Reuse buffer if there is one
+	 * Reuse buffer if there is one. Buffers are pushed onto the free queue without
+	 * the lock (see freeBuffers), so the head must be removed with a compare and swap.
 	 */
 	omrthread_monitor_enter(UT_GLOBAL(freeQueueLock));
-	
-	trcBuf = UT_GLOBAL(freeQueue);
-	if (NULL != trcBuf) {
-		UT_GLOBAL(freeQueue) = trcBuf->next;
-	}
-	
+
+	do {
+		trcBuf = UT_GLOBAL(freeQueue);
+	} while ((NULL != trcBuf) && !twCompareAndSwapPtr((uintptr_t *)&UT_GLOBAL(freeQueue), (uintptr_t)trcBuf, (uintptr_t)trcBuf->next));
+
 	omrthread_monitor_exit(UT_GLOBAL(freeQueueLock));
 	
 	if (trcBuf != NULL) {
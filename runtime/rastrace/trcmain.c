@@ -861,6 +861,9 @@ out:
 	if (UT_GLOBAL(lostRecords) != 0) {
 		UT_DBGOUT(1, ("<UT> Discarded %d trace buffers\n", UT_GLOBAL(lostRecords)));
 	}
+	if (UT_GLOBAL(wrappedBuffers) != 0) {
+		UT_DBGOUT(1, ("<UT> Wrapped in-core trace buffers %d times\n", UT_GLOBAL(wrappedBuffers)));
+	}
 	return result;
 }
 
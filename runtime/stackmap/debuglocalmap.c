@@ -721,4 +721,6 @@ void
 installDebugLocalMapper(J9JavaVM * vm)
 {
 	vm->localMapFunction = j9localmap_DebugLocalBitsForPC;
+	/* maps cached from the previous mapper may differ from those of the debug mapper */
+	j9mapcache_invalidate(vm);
 }
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stddef.h>
+#include "j9.h"
+#include "j9consts.h"
+#include "stackmap_api.h"
+#include "util_api.h"
+#include "ut_map.h"
+
+/*
+ * The VM-wide cache of local and operand stack maps, see util/directmappedcache.c.
+ * Entries are keyed by ROM method and by the PC and slot count of the map (see J9_STACKMAP_CACHE_KEY).
+ * Besides the class unload and redefinition hooks of the cache, the maps produced change when the
+ * debug local mapper is installed, which invalidates the cache explicitly.
+ */
+
+#define J9_STACKMAP_CACHE_SIZE 4096 /* must be a power of two */
+
+IDATA
+j9mapcache_initialize(J9JavaVM *vm)
+{
+	J9DirectMappedCache *cache = directMappedCacheNew(vm, J9_STACKMAP_CACHE_SIZE, OMRMEM_CATEGORY_VM);
+
+	if (NULL == cache) {
+		Trc_Map_j9mapcache_initialize_AllocationFailure(offsetof(J9DirectMappedCache, entries) + (J9_STACKMAP_CACHE_SIZE * sizeof(J9DirectMappedCacheEntry)));
+		return -1;
+	}
+	vm->stackMapCache = cache;
+	return 0;
+}
+
+void
+j9mapcache_free(J9JavaVM *vm)
+{
+	directMappedCacheFree(vm->stackMapCache);
+	vm->stackMapCache = NULL;
+}
+
+void
+j9mapcache_invalidate(J9JavaVM *vm)
+{
+	J9DirectMappedCache *cache = vm->stackMapCache;
+
+	if (NULL != cache) {
+		UDATA generation = directMappedCacheInvalidate(cache);
+		Trc_Map_j9mapcache_invalidate(generation);
+	}
+}
@@ -31,6 +31,7 @@
 #include "vmi.h"
 #include "ibmjvmti.h"
 #include "jlm.h"
+#include "HeapIteratorAPI.h"
 
 #ifdef J9VM_THR_LOCK_NURSERY
 #include "lockNurseryUtil.h"
@@ -609,3 +610,159 @@ Java_j9vm_test_softmx_TestNatives_setAggressiveGCPolicy(JNIEnv* env, jclass claz
 }
 
 
+
+/* Slots of the array filled in by ParallelHeapWalkTest.walkHeap() */
+#define HEAPWALK_SERIAL_COUNT 0
+#define HEAPWALK_PARALLEL_COUNT 1
+#define HEAPWALK_WORKERS_FINISHED 2
+#define HEAPWALK_WORKERS_INVALID 3
+#define HEAPWALK_SERIAL_REGION_ABORT_COUNT 4
+#define HEAPWALK_SERIAL_REGION_ABORT_RESULT 5
+#define HEAPWALK_PARALLEL_REGION_ABORT_COUNT 6
+#define HEAPWALK_PARALLEL_REGION_ABORT_RESULT 7
+#define HEAPWALK_PARALLEL_ABORT_COUNT 8
+#define HEAPWALK_PARALLEL_ABORT_RESULT 9
+#define HEAPWALK_RESULT_COUNT 10
+
+#define HEAPWALK_WORKER_TAG ((UDATA)0x5741 /* "WA" */)
+
+/**
+ * Per-worker context of a parallel heap walk.
+ */
+typedef struct HeapWalkWorkerData {
+	UDATA tag; /* HEAPWALK_WORKER_TAG, to check that workerFinish gets what workerStart returned */
+	UDATA count; /* Objects visited by this worker */
+	BOOLEAN abort; /* Whether to abort on every object */
+} HeapWalkWorkerData;
+
+/**
+ * Reduction target of a parallel heap walk.
+ */
+typedef struct HeapWalkUserData {
+	J9PortLibrary *portLibrary;
+	BOOLEAN abort; /* Whether the workers abort on every object */
+	UDATA count; /* Sum of the objects visited by the workers */
+	UDATA workersFinished; /* Number of calls to workerFinish */
+	UDATA workersInvalid; /* Number of calls to workerFinish with a context workerStart did not return */
+} HeapWalkUserData;
+
+static jvmtiIterationControl
+heapWalkCountObject(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData)
+{
+	*(UDATA *)userData += 1;
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+heapWalkCountObjectAndAbort(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData)
+{
+	*(UDATA *)userData += 1;
+	return JVMTI_ITERATION_ABORT;
+}
+
+static void *
+heapWalkWorkerStart(J9JavaVM *vm, void *userData)
+{
+	HeapWalkUserData *walkData = (HeapWalkUserData *)userData;
+	PORT_ACCESS_FROM_PORT(walkData->portLibrary);
+	HeapWalkWorkerData *workerData = j9mem_allocate_memory(sizeof(HeapWalkWorkerData), OMRMEM_CATEGORY_VM);
+
+	if (NULL != workerData) {
+		workerData->tag = HEAPWALK_WORKER_TAG;
+		workerData->count = 0;
+		workerData->abort = walkData->abort;
+	}
+	return workerData;
+}
+
+static jvmtiIterationControl
+heapWalkWorkerObject(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *workerData)
+{
+	HeapWalkWorkerData *castWorkerData = (HeapWalkWorkerData *)workerData;
+
+	if (NULL == castWorkerData) {
+		return JVMTI_ITERATION_ABORT;
+	}
+	castWorkerData->count += 1;
+	return castWorkerData->abort ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
+static void
+heapWalkWorkerFinish(J9JavaVM *vm, void *workerData, void *userData)
+{
+	HeapWalkUserData *walkData = (HeapWalkUserData *)userData;
+	HeapWalkWorkerData *castWorkerData = (HeapWalkWorkerData *)workerData;
+	PORT_ACCESS_FROM_PORT(walkData->portLibrary);
+
+	/* calls are serialized by the walk, so no atomics are needed here */
+	walkData->workersFinished += 1;
+	if ((NULL == castWorkerData) || (HEAPWALK_WORKER_TAG != castWorkerData->tag)) {
+		walkData->workersInvalid += 1;
+	} else {
+		walkData->count += castWorkerData->count;
+		castWorkerData->tag = 0;
+		j9mem_free_memory(castWorkerData);
+	}
+}
+
+/**
+ * Walk the heap serially and in parallel, under one period of exclusive VM access so that
+ * every walk sees the same heap, and record the results in the HEAPWALK_* slots of results.
+ *
+ * @param env[in] The JNIEnv
+ * @param clazz[in] The class on which the method was invoked
+ * @param results[out] An array of at least HEAPWALK_RESULT_COUNT longs
+ */
+void JNICALL
+Java_j9vm_test_heapwalk_ParallelHeapWalkTest_walkHeap(JNIEnv* env, jclass clazz, jlongArray results)
+{
+	J9VMThread *vmThread = (J9VMThread *) env;
+	J9JavaVM *javaVM = vmThread->javaVM;
+	J9MemoryManagerFunctions const *mmFuncs = javaVM->memoryManagerFunctions;
+	jlong values[HEAPWALK_RESULT_COUNT];
+	HeapWalkUserData walkData;
+	UDATA count = 0;
+	jvmtiIterationControl rc = JVMTI_ITERATION_CONTINUE;
+
+	memset(values, 0, sizeof(values));
+	memset(&walkData, 0, sizeof(walkData));
+	walkData.portLibrary = javaVM->portLibrary;
+
+	javaVM->internalVMFunctions->internalEnterVMFromJNI(vmThread);
+	javaVM->internalVMFunctions->acquireExclusiveVMAccess(vmThread);
+	mmFuncs->j9gc_flush_caches_for_walk(javaVM);
+
+	/* every object, serially and then in parallel */
+	mmFuncs->j9mm_iterate_all_objects(javaVM, javaVM->portLibrary, 0, heapWalkCountObject, &count);
+	values[HEAPWALK_SERIAL_COUNT] = (jlong)count;
+
+	walkData.abort = FALSE;
+	mmFuncs->j9mm_parallel_iterate_all_objects(vmThread, javaVM->portLibrary, 0, heapWalkWorkerObject, heapWalkWorkerStart, heapWalkWorkerFinish, &walkData);
+	values[HEAPWALK_PARALLEL_COUNT] = (jlong)walkData.count;
+
+	/* aborting on every object with j9mm_iterator_flag_abort_region_only visits the first object of each region */
+	count = 0;
+	rc = mmFuncs->j9mm_iterate_all_objects(javaVM, javaVM->portLibrary, j9mm_iterator_flag_abort_region_only, heapWalkCountObjectAndAbort, &count);
+	values[HEAPWALK_SERIAL_REGION_ABORT_COUNT] = (jlong)count;
+	values[HEAPWALK_SERIAL_REGION_ABORT_RESULT] = (jlong)rc;
+
+	walkData.abort = TRUE;
+	walkData.count = 0;
+	rc = mmFuncs->j9mm_parallel_iterate_all_objects(vmThread, javaVM->portLibrary, j9mm_iterator_flag_abort_region_only, heapWalkWorkerObject, heapWalkWorkerStart, heapWalkWorkerFinish, &walkData);
+	values[HEAPWALK_PARALLEL_REGION_ABORT_COUNT] = (jlong)walkData.count;
+	values[HEAPWALK_PARALLEL_REGION_ABORT_RESULT] = (jlong)rc;
+
+	/* without the flag, the first abort ends the walk; regions already being walked by other workers still end at their first object */
+	walkData.count = 0;
+	rc = mmFuncs->j9mm_parallel_iterate_all_objects(vmThread, javaVM->portLibrary, 0, heapWalkWorkerObject, heapWalkWorkerStart, heapWalkWorkerFinish, &walkData);
+	values[HEAPWALK_PARALLEL_ABORT_COUNT] = (jlong)walkData.count;
+	values[HEAPWALK_PARALLEL_ABORT_RESULT] = (jlong)rc;
+
+	values[HEAPWALK_WORKERS_FINISHED] = (jlong)walkData.workersFinished;
+	values[HEAPWALK_WORKERS_INVALID] = (jlong)walkData.workersInvalid;
+
+	javaVM->internalVMFunctions->releaseExclusiveVMAccess(vmThread);
+	javaVM->internalVMFunctions->internalExitVMToJNI(vmThread);
+
+	(*env)->SetLongArrayRegion(env, results, 0, HEAPWALK_RESULT_COUNT, values);
+}
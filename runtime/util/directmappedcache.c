@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include "j9.h"
+#include "j9consts.h"
+#include "util_api.h"
+#include "vmhook.h"
+
+/*
+ * A fixed size, direct mapped cache, shared by all threads, of values which are keyed by a ROM
+ * method (or other VM structure) and a word.
+ *
+ * Each entry is protected by a sequence number which is odd while the entry is being written.
+ * Readers never block: an entry which is being written, or which changed while it was being
+ * read, is treated as a miss.  Writers which fail to claim an entry simply do not cache the value.
+ *
+ * ROM methods may be freed and their memory reused when classes are unloaded or redefined, so the
+ * cache has a generation which is advanced to invalidate every entry at once.
+ */
+
+#define J9_DIRECTMAPPED_CACHE_INDEX(cache, owner, key) \
+	(((((UDATA)(owner)) >> 3) ^ ((key) * 31)) & (cache)->mask)
+
+static void hookInvalidateDirectMappedCache(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+
+J9DirectMappedCache *
+directMappedCacheNew(J9JavaVM *vm, UDATA entryCount, U_32 memoryCategory)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9HookInterface **vmHooks = J9_HOOK_INTERFACE(vm->hookInterface);
+	UDATA cacheSize = offsetof(J9DirectMappedCache, entries) + (entryCount * sizeof(J9DirectMappedCacheEntry));
+	J9DirectMappedCache *cache = j9mem_allocate_memory(cacheSize, memoryCategory);
+
+	if (NULL == cache) {
+		return NULL;
+	}
+	memset(cache, 0, cacheSize);
+	cache->javaVM = vm;
+	cache->mask = entryCount - 1;
+	/* generation 0 is reserved for entries which have never been written */
+	cache->generation = 1;
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	if ((0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, hookInvalidateDirectMappedCache, OMR_GET_CALLSITE(), cache))
+	|| (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, hookInvalidateDirectMappedCache, OMR_GET_CALLSITE(), cache))
+	) {
+		goto fail;
+	}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+	if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, hookInvalidateDirectMappedCache, OMR_GET_CALLSITE(), cache)) {
+		goto fail;
+	}
+	return cache;
+
+fail:
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, hookInvalidateDirectMappedCache, cache);
+	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, hookInvalidateDirectMappedCache, cache);
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+	j9mem_free_memory(cache);
+	return NULL;
+}
+
+void
+directMappedCacheFree(J9DirectMappedCache *cache)
+{
+	if (NULL != cache) {
+		J9JavaVM *vm = cache->javaVM;
+		J9HookInterface **vmHooks = J9_HOOK_INTERFACE(vm->hookInterface);
+		PORT_ACCESS_FROM_JAVAVM(vm);
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, hookInvalidateDirectMappedCache, cache);
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, hookInvalidateDirectMappedCache, cache);
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, hookInvalidateDirectMappedCache, cache);
+		j9mem_free_memory(cache);
+	}
+}
+
+UDATA
+directMappedCacheInvalidate(J9DirectMappedCache *cache)
+{
+	UDATA generation = addAtomic(&cache->generation, 1);
+
+	if (0 == generation) {
+		/* skip the generation reserved for unwritten entries */
+		generation = addAtomic(&cache->generation, 1);
+	}
+	return generation;
+}
+
+J9DirectMappedCacheEntry *
+directMappedCacheBeginLookup(J9DirectMappedCache *cache, void *owner, UDATA key, UDATA *value, UDATA *sequence)
+{
+	J9DirectMappedCacheEntry *entry = &cache->entries[J9_DIRECTMAPPED_CACHE_INDEX(cache, owner, key)];
+	UDATA entrySequence = entry->sequence;
+
+	if (J9_ARE_NO_BITS_SET(entrySequence, 1)) {
+		UDATA generation = cache->generation;
+
+		issueReadBarrier();
+		if ((entry->owner == owner) && (entry->key == key) && (entry->generation == generation)) {
+			*value = entry->value;
+			*sequence = entrySequence;
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+BOOLEAN
+directMappedCacheEndLookup(J9DirectMappedCacheEntry *entry, UDATA sequence)
+{
+	issueReadBarrier();
+	return sequence == entry->sequence;
+}
+
+J9DirectMappedCacheEntry *
+directMappedCacheBeginStore(J9DirectMappedCache *cache, void *owner, UDATA key, UDATA *sequence)
+{
+	J9DirectMappedCacheEntry *entry = &cache->entries[J9_DIRECTMAPPED_CACHE_INDEX(cache, owner, key)];
+	UDATA entrySequence = entry->sequence;
+
+	/* if another thread is writing this entry, leave it to that thread */
+	if (J9_ARE_NO_BITS_SET(entrySequence, 1) && (entrySequence == compareAndSwapUDATA((UDATA *)&entry->sequence, entrySequence, entrySequence + 1))) {
+		*sequence = entrySequence;
+		return entry;
+	}
+	return NULL;
+}
+
+void
+directMappedCacheEndStore(J9DirectMappedCacheEntry *entry, void *owner, UDATA key, UDATA generation, UDATA value, UDATA sequence)
+{
+	entry->owner = owner;
+	entry->key = key;
+	entry->generation = generation;
+	entry->value = value;
+	issueWriteBarrier();
+	entry->sequence = sequence + 2;
+}
+
+BOOLEAN
+directMappedCacheLookup(J9DirectMappedCache *cache, void *owner, UDATA key, UDATA *value)
+{
+	UDATA sequence = 0;
+	UDATA cachedValue = 0;
+	J9DirectMappedCacheEntry *entry = directMappedCacheBeginLookup(cache, owner, key, &cachedValue, &sequence);
+
+	if ((NULL != entry) && directMappedCacheEndLookup(entry, sequence)) {
+		*value = cachedValue;
+		return TRUE;
+	}
+	return FALSE;
+}
+
+void
+directMappedCacheStore(J9DirectMappedCache *cache, void *owner, UDATA key, UDATA generation, UDATA value)
+{
+	UDATA sequence = 0;
+	J9DirectMappedCacheEntry *entry = directMappedCacheBeginStore(cache, owner, key, &sequence);
+
+	if (NULL != entry) {
+		directMappedCacheEndStore(entry, owner, key, generation, value, sequence);
+	}
+}
+
+void
+directMappedCacheRecordLookups(J9DirectMappedCache *cache, UDATA hits, UDATA misses)
+{
+	if (0 != hits) {
+		addAtomic(&cache->hits, hits);
+	}
+	if (0 != misses) {
+		addAtomic(&cache->misses, misses);
+	}
+}
+
+static void
+hookInvalidateDirectMappedCache(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	directMappedCacheInvalidate((J9DirectMappedCache *)userData);
+}
@@ -729,3 +729,24 @@ getLineNumberForROMClassFromROMMethod(J9JavaVM *vm, J9ROMMethod *romMethod, J9RO
 	return number;
 }
 
+#if !defined(J9VM_OUT_OF_PROCESS)
+UDATA
+getCachedLineNumberForROMMethod(J9JavaVM *vm, J9ROMMethod *romMethod, J9ROMClass *romClass, UDATA offset, J9ClassLoader *classLoader, UDATA relativePC)
+{
+	J9DirectMappedCache *cache = vm->lineNumberCache;
+	UDATA lineNumber = (UDATA)-1;
+
+	if (NULL == cache) {
+		lineNumber = getLineNumberForROMClassFromROMMethod(vm, romMethod, romClass, offset, classLoader, relativePC);
+	} else if (!directMappedCacheLookup(cache, romMethod, relativePC, &lineNumber)) {
+		/* the generation read before decoding, so that a line decoded from an unloaded method is never cached as current */
+		UDATA generation = cache->generation;
+
+		lineNumber = getLineNumberForROMClassFromROMMethod(vm, romMethod, romClass, offset, classLoader, relativePC);
+		directMappedCacheStore(cache, romMethod, relativePC, generation, lineNumber);
+	}
+
+	return lineNumber;
+}
+#endif /* !J9VM_OUT_OF_PROCESS */
+
@@ -6683,6 +6683,22 @@ done:
 		return GOTO_RUN_METHOD;
 	}
 
+	/**
+	 * Find the entry in the current thread's invokeinterface cache for a call site and receiver class.
+	 * The cache is direct mapped, and is flushed when classes are unloaded or redefined.
+	 *
+	 * @param ramMethodRef[in] the constant pool slot of the call site
+	 * @param receiverClass[in] the class of the receiver
+	 *
+	 * @return the cache entry for the site and receiver, which may hold a different key
+	 */
+	VMINLINE J9InterfaceCallCacheEntry *
+	interfaceCallCacheEntry(REGISTER_ARGS_LIST, J9RAMInterfaceMethodRef *ramMethodRef, J9Class *receiverClass)
+	{
+		UDATA hash = ((UDATA)ramMethodRef / sizeof(J9RAMInterfaceMethodRef)) ^ ((UDATA)receiverClass / J9_REQUIRED_CLASS_ALIGNMENT);
+		return &_currentThread->interfaceCallCache[hash & (J9VM_INTERFACE_CALL_CACHE_SIZE - 1)];
+	}
+
 	VMINLINE VM_BytecodeAction
 	invokeinterfaceOffset(REGISTER_ARGS_LIST, UDATA offset)
 	{
@@ -6717,6 +6733,7 @@ resolve:
 			J9Class *receiverClass = J9OBJECT_CLAZZ(_currentThread, receiver);
 			UDATA methodIndex = methodIndexAndArgCount >> J9_ITABLE_INDEX_SHIFT;
 			J9ROMMethod *romMethod = NULL;
+			J9InterfaceCallCacheEntry *cacheEntry = NULL;
 
 			/* Run search in receiverClass->lastITable */
 			J9ITable *iTable = receiverClass->lastITable;
@@ -6724,6 +6741,17 @@ resolve:
 				goto foundITableCache;
 			}
 
+			/* Polymorphic call sites miss in lastITable, so look for this site and receiver in the thread's cache */
+			cacheEntry = interfaceCallCacheEntry(REGISTER_ARGS, ramMethodRef, receiverClass);
+			if ((ramMethodRef == cacheEntry->methodRef) && (receiverClass == cacheEntry->receiverClass)) {
+				_currentThread->interfaceCallCacheHits += 1;
+				_sendMethod = cacheEntry->method;
+				profileInvokeReceiver(REGISTER_ARGS, receiverClass, _literals, _sendMethod);
+				_pc += offset;
+				goto done;
+			}
+			_currentThread->interfaceCallCacheMisses += 1;
+
 			/* Start search from receiverClass->iTable */
 			iTable = (J9ITable*)receiverClass->iTable;
 			while (NULL != iTable) {
@@ -6766,6 +6794,12 @@ foundITableCache:
 						rc = GOTO_THROW_CURRENT_EXCEPTION;
 						goto done;
 					}
+					if (NULL != cacheEntry) {
+						/* The lastITable search missed, so remember the target for this site and receiver */
+						cacheEntry->methodRef = ramMethodRef;
+						cacheEntry->receiverClass = receiverClass;
+						cacheEntry->method = _sendMethod;
+					}
 					profileInvokeReceiver(REGISTER_ARGS, receiverClass, _literals, _sendMethod);
 					_pc += offset;
 					goto done;
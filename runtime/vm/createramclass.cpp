@@ -130,16 +130,32 @@ typedef struct J9OverrideErrorData {
 	J9UTF8 *methodSigUTF;
 } J9OverrideErrorData;
 
+/* Temporary index of the vTable under construction keyed on method name and signature, so that override
+ * and interface method lookups do not scan every slot. Slots are stored one based so that 0 terminates a
+ * chain, and each chain runs from the highest slot to the lowest (the order of the linear scans).
+ */
+typedef struct J9VTableLookupIndex {
+	U_32 *buckets;
+	U_32 *next;
+	UDATA bucketMask;
+} J9VTableLookupIndex;
+
+/* Minimum number of potential vTable slots for which building a J9VTableLookupIndex pays off */
+#define VTABLE_LOOKUP_INDEX_THRESHOLD 64
+
 static J9Class* markInterfaces(J9ROMClass *romClass, J9Class *superclass, J9ClassLoader *classLoader, BOOLEAN *foundCloneable, UDATA *markedInterfaceCount, UDATA *inheritedInterfaceCount, IDATA *maxInterfaceDepth);
 static void unmarkInterfaces(J9Class *interfaceHead);
 static void createITable(J9VMThread* vmStruct, J9Class *ramClass, J9Class *interfaceClass, J9ITable ***previousLink, UDATA **currentSlot, UDATA depth);
 static UDATA* initializeRAMClassITable(J9VMThread* vmStruct, J9Class *ramClass, J9Class *superclass, UDATA* currentSlot, J9Class *interfaceHead, IDATA maxInterfaceDepth);
-static UDATA addInterfaceMethods(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *interfaceClass, UDATA vTableMethodCount, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, UDATA *defaultConflictCount, J9Pool *equivalentSets, UDATA *equivSetCount, J9OverrideErrorData *errorData);
+static UDATA addInterfaceMethods(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *interfaceClass, UDATA vTableMethodCount, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, UDATA *defaultConflictCount, J9Pool *equivalentSets, UDATA *equivSetCount, J9OverrideErrorData *errorData, J9VTableLookupIndex *lookupIndex);
 static UDATA* computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *superclass, J9ROMClass *taggedClass, UDATA packageID, J9ROMMethod ** methodRemapArray, J9Class *interfaceHead, UDATA *defaultConflictCount, UDATA interfaceCount, UDATA inheritedInterfaceCount, J9OverrideErrorData *errorData);
 static void copyVTable(J9VMThread *vmStruct, J9Class *ramClass, J9Class *superclass, UDATA *vTable, UDATA defaultConflictCount);
-static UDATA processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA localPackageID, UDATA vTableMethodCount, void *storeValue, J9OverrideErrorData *errorData);
-static VMINLINE UDATA growNewVTableSlot(UDATA *vTableAddress, UDATA vTableMethodCount, void *storeValue);
-static UDATA getVTableIndexForNameAndSigStartingAt(UDATA *vTable, J9UTF8 *name, J9UTF8 *signature, UDATA vTableIndex);
+static UDATA processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA localPackageID, UDATA vTableMethodCount, void *storeValue, J9OverrideErrorData *errorData, J9VTableLookupIndex *lookupIndex);
+static VMINLINE UDATA growNewVTableSlot(UDATA *vTableAddress, UDATA vTableMethodCount, void *storeValue, J9VTableLookupIndex *lookupIndex, UDATA hash);
+static UDATA getVTableIndexForNameAndSigStartingAt(UDATA *vTable, J9UTF8 *name, J9UTF8 *signature, UDATA vTableIndex, J9VTableLookupIndex *lookupIndex, UDATA hash);
+static VMINLINE UDATA vTableLookupHash(J9UTF8 *name, J9UTF8 *signature);
+static VMINLINE void vTableLookupIndexAdd(J9VTableLookupIndex *lookupIndex, UDATA hash, UDATA vTableIndex);
+static VMINLINE UDATA vTableLookupIndexFind(J9VTableLookupIndex *lookupIndex, UDATA hash, UDATA vTableIndex);
 static UDATA checkPackageAccess(J9VMThread *vmThread, J9Class *foundClass, UDATA classPreloadFlags);
 static void setCurrentExceptionForBadClass(J9VMThread *vmThread, J9UTF8 *badClassName, UDATA exceptionIndex);
 static BOOLEAN verifyClassLoadingStack(J9VMThread *vmThread, J9ClassLoader *classLoader, J9ROMClass *romClass);
@@ -428,7 +444,7 @@ typedef enum {
 
 
 static UDATA
-addInterfaceMethods(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *interfaceClass, UDATA vTableMethodCount, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, UDATA *defaultConflictCount, J9Pool *equivalentSets, UDATA *equivSetCount, J9OverrideErrorData *errorData)
+addInterfaceMethods(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *interfaceClass, UDATA vTableMethodCount, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, UDATA *defaultConflictCount, J9Pool *equivalentSets, UDATA *equivSetCount, J9OverrideErrorData *errorData, J9VTableLookupIndex *lookupIndex)
 {
 	J9Method **vTableMethods = J9VTABLE_FROM_HEADER(vTableAddress);
 	J9ROMClass *interfaceROMClass = interfaceClass->romClass;
@@ -445,6 +461,7 @@ addInterfaceMethods(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *i
 			if (J9_ARE_NO_BITS_SET(romMethod->modifiers, J9_JAVA_PRIVATE | J9_JAVA_STATIC)) {
 				J9UTF8 *interfaceMethodNameUTF = J9ROMMETHOD_NAME(romMethod);
 				J9UTF8 *interfaceMethodSigUTF = J9ROMMETHOD_SIGNATURE(romMethod);
+				UDATA interfaceMethodHash = (NULL != lookupIndex) ? vTableLookupHash(interfaceMethodNameUTF, interfaceMethodSigUTF) : 0;
 				UDATA tempIndex = vTableMethodCount;
 				INTERFACE_STATE state = SLOT_IS_INVALID;
 				
@@ -452,8 +469,16 @@ addInterfaceMethods(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *i
 				 * either an abstract interface method or default method conflict, do not
 				 * process the interface method at all. */
 				while (tempIndex > 0) {
-					/* Decrement the index, convert from one based to zero based index */
-					tempIndex -= 1;
+					if (NULL == lookupIndex) {
+						/* Decrement the index, convert from one based to zero based index */
+						tempIndex -= 1;
+					} else {
+						/* Skip directly to the next lower slot which may have the same name and signature */
+						tempIndex = vTableLookupIndexFind(lookupIndex, interfaceMethodHash, tempIndex);
+						if ((UDATA)-1 == tempIndex) {
+							break;
+						}
+					}
 
 					J9ROMClass *methodROMClass = NULL;
 					J9Class *methodClass = NULL;
@@ -604,7 +629,7 @@ add_existing:
 					}
 				}
 				/* Add the interface method as the Local class does not implement a public method of the given name. */
-				vTableMethodCount = growNewVTableSlot((UDATA *)vTableMethods, vTableMethodCount, interfaceMethod);
+				vTableMethodCount = growNewVTableSlot((UDATA *)vTableMethods, vTableMethodCount, interfaceMethod, lookupIndex, interfaceMethodHash);
 #if defined(J9VM_TRACE_VTABLE_ACCESS)
 				{
 					PORT_ACCESS_FROM_VMC(vmStruct);
@@ -711,8 +736,12 @@ computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *supercl
 	UDATA maxSlots;
 	UDATA *vTableAddress = NULL;
 	bool vTableAllocated = false;
+	UDATA lookupIndexCapacity = 0;
+	J9VTableLookupIndex lookupIndexStorage;
+	J9VTableLookupIndex *lookupIndex = NULL;
 
 	PORT_ACCESS_FROM_VMC(vmStruct);
+	U_64 startTime = j9time_hires_clock();
 
 #if defined(J9VM_INTERP_HOT_CODE_REPLACEMENT)
 	if (((UDATA)taggedClass & ROM_METHOD_ID_TAG) == ROM_METHOD_ID_TAG) {
@@ -758,6 +787,8 @@ computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *supercl
 		}
 	}
 
+	lookupIndexCapacity = maxSlots;
+
 	/* convert slots to bytes */
 	maxSlots *= sizeof(UDATA);
 	
@@ -804,6 +835,33 @@ computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *supercl
 			UDATA romMethodIndex = 0;
 			UDATA count = romClass->romMethodCount;
 			
+			/* For large vTables, index the inherited slots by name and signature. If the index cannot
+			 * be allocated, fall back to scanning the vTable.
+			 */
+			if (lookupIndexCapacity >= VTABLE_LOOKUP_INDEX_THRESHOLD) {
+				UDATA bucketCount = 1;
+				U_32 *lookupIndexMemory = NULL;
+
+				while (bucketCount < (lookupIndexCapacity * 2)) {
+					bucketCount <<= 1;
+				}
+				lookupIndexMemory = (U_32 *)j9mem_allocate_memory((bucketCount + lookupIndexCapacity) * sizeof(U_32), J9MEM_CATEGORY_CLASSES);
+				if (NULL != lookupIndexMemory) {
+					J9Method **vTableMethods = J9VTABLE_FROM_HEADER(vTableAddress);
+					UDATA slot = 0;
+
+					memset(lookupIndexMemory, 0, bucketCount * sizeof(U_32));
+					lookupIndexStorage.buckets = lookupIndexMemory;
+					lookupIndexStorage.next = lookupIndexMemory + bucketCount;
+					lookupIndexStorage.bucketMask = bucketCount - 1;
+					lookupIndex = &lookupIndexStorage;
+					for (slot = 0; slot < vTableMethodCount; slot++) {
+						J9ROMMethod *inheritedMethod = J9_ROM_METHOD_FROM_RAM_METHOD(vTableMethods[slot]);
+						vTableLookupIndexAdd(lookupIndex, vTableLookupHash(J9ROMMETHOD_NAME(inheritedMethod), J9ROMMETHOD_SIGNATURE(inheritedMethod)), slot);
+					}
+				}
+			}
+
 			/* Walk over ROM Methods. If the methodRemapArray is supplied, use the array as a source of
 			 * J9ROMMethods instead of romClass->romMethods.  The methodRemapArray is specified by 
 			 * HCR to ensure that the replacement class vtable has the same method order as the original class
@@ -824,7 +882,7 @@ computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *supercl
 					&& ('<' != J9UTF8_DATA(methodName)[0])
 					) {
 						vTableMethodCount = processVTableMethod(vmStruct, classLoader, vTableAddress, superclass, romClass, romMethod,
-								packageID, vTableMethodCount, (J9ROMMethod *)((UDATA)romMethod + ROM_METHOD_ID_TAG), errorData);
+								packageID, vTableMethodCount, (J9ROMMethod *)((UDATA)romMethod + ROM_METHOD_ID_TAG), errorData, lookupIndex);
 						if ((UDATA)-1 == vTableMethodCount) {
 							goto fail;
 						}
@@ -898,7 +956,7 @@ computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *supercl
 						j9tty_printf(PORTLIB, "\n\t<%.*s>", J9UTF8_LENGTH(className), J9UTF8_DATA(className));
 					}
 #endif /* VERBOSE_INTERFACE_METHODS */
-					vTableMethodCount = addInterfaceMethods(vmStruct, classLoader, interfaces[i - 1], vTableMethodCount, vTableAddress, superclass, romClass, defaultConflictCount, equivalentSet, &equivSetCount, errorData);
+					vTableMethodCount = addInterfaceMethods(vmStruct, classLoader, interfaces[i - 1], vTableMethodCount, vTableAddress, superclass, romClass, defaultConflictCount, equivalentSet, &equivSetCount, errorData, lookupIndex);
 					if ((UDATA)-1 == vTableMethodCount) {
 						if (NULL != equivalentSet) {
 							pool_kill(equivalentSet);
@@ -926,6 +984,16 @@ computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *supercl
 	}
 	
 done:
+	if (NULL != vTableAddress) {
+		J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+		Trc_VM_computeVTable_summary(vmStruct, J9UTF8_LENGTH(className), J9UTF8_DATA(className), ((J9VTableHeader *)vTableAddress)->size,
+				(NULL != lookupIndex) ? "hashed" : "linear",
+				j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+	}
+	if (NULL != lookupIndex) {
+		j9mem_free_memory(lookupIndex->buckets);
+		lookupIndex = NULL;
+	}
 	return vTableAddress;
 fail:
 	if (vTableAllocated) {
@@ -1160,7 +1228,7 @@ fillJITVTableSlot(J9VMThread *vmStruct, UDATA *currentSlot, J9Method *currentMet
 #endif
 
 static UDATA
-processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA localPackageID, UDATA vTableMethodCount, void *storeValue, J9OverrideErrorData *errorData)
+processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA localPackageID, UDATA vTableMethodCount, void *storeValue, J9OverrideErrorData *errorData, J9VTableLookupIndex *lookupIndex)
 {
 	UDATA newModifiers = romMethod->modifiers;
 
@@ -1169,6 +1237,7 @@ processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTa
 		UDATA *vTableMethods = (UDATA *)J9VTABLE_FROM_HEADER(vTableAddress);
 		J9UTF8 *nameUTF = J9ROMMETHOD_NAME(romMethod);
 		J9UTF8 *sigUTF = J9ROMMETHOD_SIGNATURE(romMethod);
+		UDATA hash = (NULL != lookupIndex) ? vTableLookupHash(nameUTF, sigUTF) : 0;
 		UDATA newSlotRequired = TRUE;
 
 		if (NULL != superclass) {
@@ -1182,7 +1251,7 @@ processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTa
 
 			/* See if this method overrides any methods from any superclass. */
 			while ((superclassVTableIndex = getVTableIndexForNameAndSigStartingAt(superclassVTableMethods, nameUTF, sigUTF,
-					superclassVTableIndex)) != (UDATA)-1)
+					superclassVTableIndex, lookupIndex, hash)) != (UDATA)-1)
 			{
 				UDATA overridden = FALSE;
 				/* fetch vTable entry */
@@ -1287,7 +1356,7 @@ processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTa
 		/* If the method requires a new slot in the vTable, allocate it */
 		if (newSlotRequired) {
 			/* allocate vTable slot */
-			vTableMethodCount = growNewVTableSlot(vTableMethods, vTableMethodCount, storeValue);
+			vTableMethodCount = growNewVTableSlot(vTableMethods, vTableMethodCount, storeValue, lookupIndex, hash);
 #if defined(J9VM_TRACE_VTABLE_ACCESS)
 			{
 				PORT_ACCESS_FROM_VMC(vmThread);
@@ -1308,20 +1377,75 @@ done:
  * @param vTableAddress[in] A pointer to the buffer that holds the vtable (must be correctly sized)
  * @param vTableMethodCount[in] The number of method currently in the vtable
  * @param storeValue[in] the value to store into the vtable slot - either a J9Method* or a tagged J9ROMMethod
+ * @param lookupIndex[in] The name and signature index of the vtable, or NULL if there is none
+ * @param hash[in] The name and signature hash of the method being stored (ignored if lookupIndex is NULL)
  * @return The new vTableMethodCount
  */
 static VMINLINE UDATA
-growNewVTableSlot(UDATA *vTableAddress, UDATA vTableMethodCount, void *storeValue)
+growNewVTableSlot(UDATA *vTableAddress, UDATA vTableMethodCount, void *storeValue, J9VTableLookupIndex *lookupIndex, UDATA hash)
 {
 	/* fill in vtable, add new entry */
 	vTableAddress[vTableMethodCount] = (UDATA)storeValue;
+	if (NULL != lookupIndex) {
+		vTableLookupIndexAdd(lookupIndex, hash, vTableMethodCount);
+	}
 	vTableMethodCount += 1;
 
 	return vTableMethodCount;
 }
 
+/**
+ * Hash a method name and signature for a J9VTableLookupIndex.
+ */
+static VMINLINE UDATA
+vTableLookupHash(J9UTF8 *name, J9UTF8 *signature)
+{
+	UDATA hash = J9UTF8_LENGTH(signature);
+	U_8 *data = J9UTF8_DATA(name);
+	U_8 *end = data + J9UTF8_LENGTH(name);
+
+	while (data < end) {
+		hash = (hash * 31) + *data++;
+	}
+	data = J9UTF8_DATA(signature);
+	end = data + J9UTF8_LENGTH(signature);
+	while (data < end) {
+		hash = (hash * 31) + *data++;
+	}
+	return hash;
+}
+
+/**
+ * Record a (zero based) vTable slot in the lookup index. Slots must be added in ascending order.
+ */
+static VMINLINE void
+vTableLookupIndexAdd(J9VTableLookupIndex *lookupIndex, UDATA hash, UDATA vTableIndex)
+{
+	U_32 *bucket = &lookupIndex->buckets[hash & lookupIndex->bucketMask];
+
+	lookupIndex->next[vTableIndex] = *bucket;
+	*bucket = (U_32)(vTableIndex + 1);
+}
+
+/**
+ * Find the highest vTable slot below the (one based) vTableIndex whose name and signature
+ * hash into the same bucket as hash.
+ *
+ * @return the zero based slot, or (UDATA)-1 if there is none
+ */
+static VMINLINE UDATA
+vTableLookupIndexFind(J9VTableLookupIndex *lookupIndex, UDATA hash, UDATA vTableIndex)
+{
+	UDATA slot = lookupIndex->buckets[hash & lookupIndex->bucketMask];
+
+	while (slot > vTableIndex) {
+		slot = lookupIndex->next[slot - 1];
+	}
+	return slot - 1;
+}
+
 static UDATA
-getVTableIndexForNameAndSigStartingAt(UDATA *vTable, J9UTF8 *name, J9UTF8 *signature, UDATA vTableIndex)
+getVTableIndexForNameAndSigStartingAt(UDATA *vTable, J9UTF8 *name, J9UTF8 *signature, UDATA vTableIndex, J9VTableLookupIndex *lookupIndex, UDATA hash)
 {
 	U_8 *nameData = J9UTF8_DATA(name);
 	UDATA nameLength = J9UTF8_LENGTH(name);
@@ -1329,9 +1453,17 @@ getVTableIndexForNameAndSigStartingAt(UDATA *vTable, J9UTF8 *name, J9UTF8 *signa
 	UDATA signatureLength = J9UTF8_LENGTH(signature);
 
 	while (vTableIndex != 0) {
-		/* The vTableIndex passed in is 1 based, converting it to zero based search index */
-		/* move to previous vTable index */
-		vTableIndex -= 1;
+		if (NULL == lookupIndex) {
+			/* The vTableIndex passed in is 1 based, converting it to zero based search index */
+			/* move to previous vTable index */
+			vTableIndex -= 1;
+		} else {
+			/* move to the previous vTable index which may have the same name and signature */
+			vTableIndex = vTableLookupIndexFind(lookupIndex, hash, vTableIndex);
+			if ((UDATA)-1 == vTableIndex) {
+				break;
+			}
+		}
 		/* fetch next vTable entry */
 		J9Method *method = (J9Method *)vTable[vTableIndex];
 		J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
@@ -1365,7 +1497,7 @@ getVTableOffsetForMethod(J9Method * method, J9Class *clazz, J9VMThread *vmThread
 		if (vTableSize == 0) {
 			return 0;
 		} else {
-			vTableIndex = getVTableIndexForNameAndSigStartingAt((UDATA *)J9VTABLE_FROM_HEADER(vTable), nameUTF, sigUTF, vTableSize);
+			vTableIndex = getVTableIndexForNameAndSigStartingAt((UDATA *)J9VTABLE_FROM_HEADER(vTable), nameUTF, sigUTF, vTableSize, NULL, 0);
 			if (vTableIndex != (UDATA)-1) {
 				return J9VTABLE_OFFSET_FROM_INDEX(vTableIndex);
 			}
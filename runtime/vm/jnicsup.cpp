@@ -1486,9 +1486,11 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
 	Assert_VM_mustHaveVMAccess(vmThread);
 
 	if (globalRef != NULL) {
-
+		J9Pool *globalRefPool = isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences;
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_enter(vm->jniFrameMutex);
+		omrthread_monitor_t globalRefMutex = isWeak ? vm->jniWeakGlobalReferencesMutex : vm->jniGlobalReferencesMutex;
+
+		omrthread_monitor_enter(globalRefMutex);
 #endif
 
 #if defined(J9VM_GC_REALTIME)
@@ -1496,12 +1498,12 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
 			vm->memoryManagerFunctions->j9gc_objaccess_jniDeleteGlobalReference(vmThread, *((j9object_t*)globalRef));
 		}
 #endif /* defined(J9VM_GC_REALTIME) */
-		if (pool_includesElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences, globalRef) == TRUE) {
-			pool_removeElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences, globalRef);
+		if (pool_includesElement(globalRefPool, globalRef) == TRUE) {
+			pool_removeElement(globalRefPool, globalRef);
 		}
 
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_exit(vm->jniFrameMutex);
+		omrthread_monitor_exit(globalRefMutex);
 #endif
 
 	}
@@ -1520,12 +1522,18 @@ j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 	J9VMThread * vmThread = (J9VMThread *) env;
 	J9JavaVM * vm = vmThread->javaVM;
 	j9object_t * result;
+#ifdef J9VM_THR_PREEMPTIVE
+	/* Strong and weak global references each have their own mutex so that they contend neither with
+	 * each other nor with JNI ID creation and local frame management, which use jniFrameMutex.
+	 */
+	omrthread_monitor_t globalRefMutex = isWeak ? vm->jniWeakGlobalReferencesMutex : vm->jniGlobalReferencesMutex;
+#endif
 
 	Assert_VM_mustHaveVMAccess(vmThread);
 	Assert_VM_notNull(object);
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
+	omrthread_monitor_enter(globalRefMutex);
 #endif
 
 	result = (j9object_t*)pool_newElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences);
@@ -1535,7 +1543,7 @@ j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 	}
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
+	omrthread_monitor_exit(globalRefMutex);
 #endif
 
 	if (result == NULL) {
@@ -2155,33 +2163,35 @@ getObjectRefType(JNIEnv *env, jobject obj)
 		goto done;
 	}
 
-#ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
-#endif
-
 	/* Check for global ref */
 
-	if (pool_includesElement(vm->jniGlobalReferences, obj)) {
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_exit(vm->jniFrameMutex);
+	omrthread_monitor_enter(vm->jniGlobalReferencesMutex);
 #endif
+	if (pool_includesElement(vm->jniGlobalReferences, obj)) {
 		rc = JNIGlobalRefType;
+	}
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_exit(vm->jniGlobalReferencesMutex);
+#endif
+	if (JNIGlobalRefType == rc) {
 		goto done;
 	}
 
 	/* Check for weak global ref */
 
-	if (pool_includesElement(vm->jniWeakGlobalReferences, obj)) {
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_exit(vm->jniFrameMutex);
+	omrthread_monitor_enter(vm->jniWeakGlobalReferencesMutex);
 #endif
+	if (pool_includesElement(vm->jniWeakGlobalReferences, obj)) {
 		rc = JNIWeakGlobalRefType;
-		goto done;
 	}
-
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
+	omrthread_monitor_exit(vm->jniWeakGlobalReferencesMutex);
 #endif
+	if (JNIWeakGlobalRefType == rc) {
+		goto done;
+	}
 
 	/* Check for stack-based local refs */
 
@@ -214,6 +214,8 @@ deallocateVMThread(J9VMThread * vmThread, UDATA decrementZombieCount, UDATA send
 		vm->memoryManagerFunctions->cleanupMutatorModelJava(vmThread);
 	}
 
+	Trc_VM_deallocateVMThread_interfaceCallCacheStatistics(vmThread, vmThread->interfaceCallCacheHits, vmThread->interfaceCallCacheMisses);
+
 	/* Call destroy hook if requested */
 	if (sendThreadDestroyEvent) {
 		TRIGGER_J9HOOK_VM_THREAD_DESTROY(vm->hookInterface, vmThread);
@@ -230,6 +230,7 @@ static jint runLoadStage (J9JavaVM *vm, IDATA flags);
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 static void jniIDTableClassUnload (J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 #endif /* GC_DYNAMIC_CLASS_UNLOADING */
+static void flushInterfaceCallCaches (J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static jint runShutdownStage (J9JavaVM* vm, IDATA stage, void* reserved, UDATA filterFlags);
 static jint modifyDllLoadTable (J9JavaVM * vm, J9Pool* loadTable, J9VMInitArgs* j9vm_args);
 static jint processVMArgsFromFirstToLast(J9JavaVM * vm);
@@ -762,6 +763,10 @@ freeJavaVM(J9JavaVM * vm)
 		vm->classLoadingStackPool = NULL;
 	}
 
+	j9mapcache_free(vm);
+	directMappedCacheFree(vm->lineNumberCache);
+	vm->lineNumberCache = NULL;
+
 	j9mem_free_memory(vm->vTableScratch);
 	vm->vTableScratch = NULL;
 
@@ -2916,8 +2921,15 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		} else if (strcmp(testString, VMOPT_XXNOPAGEALIGNDIRECTMEMORY) == 0) {
 			vm->extendedRuntimeFlags &= ~(UDATA)J9_EXTENDED_RUNTIME_PAGE_ALIGN_DIRECT_MEMORY;
 		} else if (strcmp(testString, VMOPT_XXFASTCLASSHASHTABLE) == 0) {
+			/* When requested explicitly, use the lock-free class table lookups from the start rather than
+			 * waiting for the end of the startup phase, so that loaders running in parallel during startup
+			 * do not serialize on the classTableMutex just to find already loaded classes. No class loaders
+			 * exist yet, so every class hash table will be created non-growable.
+			 */
 			vm->extendedRuntimeFlags &= ~(UDATA)J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE;
+			vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE;
 		} else if (strcmp(testString, VMOPT_XXNOFASTCLASSHASHTABLE) == 0) {
+			vm->extendedRuntimeFlags &= ~(UDATA)J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE;
 			vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE;
 		} else if (0 == strcmp(testString, VMOPT_XXALLOWNONVIRTUALCALLS)) {
 			vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_ALLOW_NON_VIRTUAL_CALLS;
@@ -5706,12 +5718,28 @@ protectedInitializeJavaVM(J9PortLibrary* portLibrary, void * userData)
 		goto error;
 	}
 
-#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	vmHooks = getVMHookInterface(vm);
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	if(0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASS_UNLOAD, jniIDTableClassUnload, OMR_GET_CALLSITE(), NULL)) {
 		goto error;
 	}
+	if ((0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, flushInterfaceCallCaches, OMR_GET_CALLSITE(), NULL))
+	|| (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, flushInterfaceCallCaches, OMR_GET_CALLSITE(), NULL))
+	) {
+		goto error;
+	}
 #endif
+	if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, flushInterfaceCallCaches, OMR_GET_CALLSITE(), NULL)) {
+		goto error;
+	}
+
+	/* The stack map cache only speeds up stack walking, so the VM runs without it if it cannot be allocated */
+	j9mapcache_initialize(vm);
+	/* Likewise, the line number cache only speeds up building stack traces */
+	vm->lineNumberCache = directMappedCacheNew(vm, J9_LINENUMBER_CACHE_SIZE, OMRMEM_CATEGORY_VM);
+	if (NULL == vm->lineNumberCache) {
+		Trc_VM_initializeLineNumberCache_allocationFailure(offsetof(J9DirectMappedCache, entries) + (J9_LINENUMBER_CACHE_SIZE * sizeof(J9DirectMappedCacheEntry)));
+	}
 
 	/* env is not used, but must be passed for compatibility */
 	/* use NO_OBJECT, because it's too early to allocate an object -- we'll take care of that later in standardInit() or tinyInit() */
@@ -6253,6 +6281,40 @@ jniIDTableClassUnload(J9HookInterface** hook, UDATA eventNum, void* eventData, v
 
 #endif /* GC_DYNAMIC_CLASS_UNLOADING */
 
+/**
+ * Empty the interpreter invokeinterface cache of every thread, as the classes and
+ * methods it refers to are about to be unloaded or have been redefined.
+ * Exclusive VM access is held by the current thread for all of the registered events.
+ */
+static void
+flushInterfaceCallCaches(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9VMThread *currentThread = NULL;
+	J9VMThread *walkThread = NULL;
+
+	switch (eventNum) {
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	case J9HOOK_VM_CLASSES_UNLOAD:
+		currentThread = ((J9VMClassesUnloadEvent *)eventData)->currentThread;
+		break;
+	case J9HOOK_VM_ANON_CLASSES_UNLOAD:
+		currentThread = ((J9VMAnonymousClassesUnloadEvent *)eventData)->currentThread;
+		break;
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+	case J9HOOK_VM_CLASSES_REDEFINED:
+		currentThread = ((J9VMClassesRedefinedEvent *)eventData)->currentThread;
+		break;
+	default:
+		Assert_VM_unreachable();
+	}
+
+	walkThread = currentThread;
+	do {
+		memset(walkThread->interfaceCallCache, 0, sizeof(walkThread->interfaceCallCache));
+		walkThread = walkThread->linkNext;
+	} while (walkThread != currentThread);
+}
+
 #if defined(WIN32)
 static UDATA
 shutDownHookWrapper(struct J9PortLibrary* portLibrary, U_32 gpType, void* gpInfo, void* userData)
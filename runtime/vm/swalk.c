@@ -138,6 +138,8 @@ UDATA  walkStackFrames(J9VMThread *currentThread, J9StackWalkState *walkState)
 	walkState->stackMap = NULL;
 	walkState->inlineMap = NULL;
 	walkState->inlinedCallSite = NULL;
+	walkState->mapCacheHits = 0;
+	walkState->mapCacheMisses = 0;
 #ifdef J9VM_INTERP_NATIVE_SUPPORT
 	walkState->jitInfo = NULL;
 	walkState->inlineDepth = 0;
@@ -405,6 +407,14 @@ terminationPoint:
 #endif
 
 	walkState->flags = savedFlags | (walkState->flags & J9_STACKWALK_CACHE_ALLOCATED);
+#if !defined(J9VM_OUT_OF_PROCESS)
+	/* Report the map cache lookups once per walk rather than once per frame */
+	if (NULL != walkState->walkThread->javaVM->stackMapCache) {
+		directMappedCacheRecordLookups(walkState->walkThread->javaVM->stackMapCache, walkState->mapCacheHits, walkState->mapCacheMisses);
+		walkState->mapCacheHits = 0;
+		walkState->mapCacheMisses = 0;
+	}
+#endif /* !J9VM_OUT_OF_PROCESS */
 #if defined(J9VM_INTERP_STACKWALK_TRACING) && !defined(J9VM_OUT_OF_PROCESS)
 	walkState->objectSlotWalkFunction = savedOSlotIterator;
 	Trc_VRB_WalkStackFrames_Exit(currentThread, walkState->walkThread, rc);
@@ -1483,6 +1493,11 @@ getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod *
 	PORT_ACCESS_FROM_WALKSTATE(walkState);
 	IDATA errorCode;
 	J9JavaVM *vm = walkState->walkThread->javaVM;
+#if !defined(J9VM_OUT_OF_PROCESS)
+	J9DirectMappedCache *mapCache = vm->stackMapCache;
+	UDATA mapCacheKey = J9_STACKMAP_CACHE_KEY(offsetPC, argTempCount, FALSE);
+	UDATA mapCacheGeneration = 0;
+#endif /* !J9VM_OUT_OF_PROCESS */
 
 	if (!alwaysLocalMap) {
 		/*	Detect method entry vs simply executing at PC 0.  If the bytecode frame is invisible (method monitor enter or
@@ -1509,11 +1524,35 @@ getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod *
 		}
 	}
 
+#if !defined(J9VM_OUT_OF_PROCESS)
+	/* Only maps which fit in a single word are cached */
+	if ((NULL != mapCache) && (argTempCount <= 32)) {
+		UDATA cachedMap = 0;
+
+		if (directMappedCacheLookup(mapCache, romMethod, mapCacheKey, &cachedMap)) {
+			*result = (U_32)cachedMap;
+#ifdef J9VM_INTERP_STACKWALK_TRACING
+			swPrintf(walkState, 4, "\tUsing cached local map\n");
+#endif
+			walkState->mapCacheHits += 1;
+			return;
+		}
+		walkState->mapCacheMisses += 1;
+		mapCacheGeneration = mapCache->generation;
+	}
+#endif /* !J9VM_OUT_OF_PROCESS */
+
 #ifdef J9VM_INTERP_STACKWALK_TRACING
 	swPrintf(walkState, 4, "\tUsing local mapper\n");
 #endif
 	errorCode = vm->localMapFunction(PORTLIB, romClass, romMethod, offsetPC, result, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
 
+#if !defined(J9VM_OUT_OF_PROCESS)
+	if ((errorCode >= 0) && (0 != mapCacheGeneration)) {
+		directMappedCacheStore(mapCache, romMethod, mapCacheKey, mapCacheGeneration, *result);
+	}
+#endif /* !J9VM_OUT_OF_PROCESS */
+
 	if (errorCode < 0) {
 #ifdef J9VM_OUT_OF_PROCESS
 		dbgError("Local map failed, result = %p\n", errorCode);
@@ -1537,8 +1576,36 @@ getStackMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod * r
 {
 	PORT_ACCESS_FROM_WALKSTATE(walkState);
 	IDATA errorCode;
+#if !defined(J9VM_OUT_OF_PROCESS)
+	J9DirectMappedCache *mapCache = walkState->walkThread->javaVM->stackMapCache;
+	UDATA mapCacheKey = J9_STACKMAP_CACHE_KEY(offsetPC, pushCount, TRUE);
+	UDATA mapCacheGeneration = 0;
+
+	/* Only maps which fit in a single word are cached */
+	if ((NULL != mapCache) && (pushCount <= 32)) {
+		UDATA cachedMap = 0;
+
+		if (directMappedCacheLookup(mapCache, romMethod, mapCacheKey, &cachedMap)) {
+			*result = (U_32)cachedMap;
+#ifdef J9VM_INTERP_STACKWALK_TRACING
+			swPrintf(walkState, 4, "\tUsing cached stack map\n");
+#endif
+			walkState->mapCacheHits += 1;
+			return;
+		}
+		walkState->mapCacheMisses += 1;
+		mapCacheGeneration = mapCache->generation;
+	}
+#endif /* !J9VM_OUT_OF_PROCESS */
 
 	errorCode = j9stackmap_StackBitsForPC(PORTLIB, offsetPC, romClass, romMethod, result, pushCount, walkState->walkThread->javaVM, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+
+#if !defined(J9VM_OUT_OF_PROCESS)
+	if ((errorCode >= 0) && (0 != mapCacheGeneration)) {
+		directMappedCacheStore(mapCache, romMethod, mapCacheKey, mapCacheGeneration, *result);
+	}
+#endif /* !J9VM_OUT_OF_PROCESS */
+
 	if (errorCode < 0) {
 #ifdef J9VM_OUT_OF_PROCESS
 		dbgError("Stack map failed, result = %p\n", errorCode);
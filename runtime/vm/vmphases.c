@@ -33,7 +33,8 @@ void jvmPhaseChange(J9JavaVM* vm, UDATA phase) {
 	if( phase == J9VM_PHASE_NOT_STARTUP ) {
 		RasGlobalStorage *tempRasGbl;
 
-		if (J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE)) {
+		/* -XX:+FastClassHashTable enables the fast table at startup, in which case there is nothing to do */
+		if (J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE | J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE)) {
 			if (NULL != vm->classLoaderBlocks) {
 				pool_state clState;
 				J9ClassLoader *loader;
@@ -45,7 +45,7 @@
  * The zip cache version number must be changed if the zip
  * cache format changes.
  */
-#define ZIP_CACHE_VERSION 1
+#define ZIP_CACHE_VERSION 2
 
 #define UDATA_TOP_BIT    (((UDATA)1)<<(sizeof(UDATA)*8-1))
 #define ISCLASS_BIT    UDATA_TOP_BIT
@@ -53,6 +53,16 @@
 #define OFFSET_MASK	(~ISCLASS_BIT)
 #define	IMPLICIT_ENTRY	(~ISCLASS_BIT)
 
+/* Tag bits stored in the low bits of J9ZipHashSlot.hash */
+#define ZIP_INDEX_TAG_DIR	1
+#define ZIP_INDEX_TAG_CLASS	2
+#define ZIP_INDEX_TAG_SHIFT	2
+
+/* J9ZipHashIndex.flags */
+#define ZIP_INDEX_EMBEDDED	1	/* the index lives inside the chunk memory and can neither grow nor be freed */
+
+#define ZIP_INDEX_INITIAL_CAPACITY	64
+
 
 void zipCache_freeChunk (J9PortLibrary * portLib, J9ZipChunkHeader *chunk);
 J9ZipDirEntry *zipCache_searchDirListCaseInsensitive (J9ZipDirEntry * dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
@@ -66,6 +76,16 @@ IDATA helper_memicmp (const void *src1, const void *src2, UDATA length);
 J9ZipDirEntry *zipCache_copyDirEntry(J9ZipCacheEntry *orgzce, J9ZipDirEntry *orgDirEntry, J9ZipCacheEntry *zce, J9ZipDirEntry *rootEntry);
 void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce);
 void zipCache_walkCache(J9PortLibrary * portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry);
+static UDATA zipCache_indexCapacityFor(UDATA count);
+static UDATA zipCache_indexSize(UDATA capacity);
+static J9ZipHashIndex *zipCache_indexAllocate(J9PortLibrary *portLib, UDATA capacity);
+static void zipCache_indexFree(J9PortLibrary *portLib, J9ZipCacheEntry *zce);
+static UDATA zipCache_indexHash(J9ZipCacheEntry *zce, J9ZipDirEntry *parent, const char *namePtr, UDATA nameSize, UDATA tag);
+static void zipCache_indexPlace(J9ZipHashIndex *index, J9ZipDirEntry *parent, void *entry, UDATA hash);
+static void zipCache_indexInsert(J9PortLibrary *portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *parent, void *entry, const char *namePtr, UDATA nameSize, UDATA tag);
+static void *zipCache_indexLookup(J9ZipCacheEntry *zce, J9ZipHashIndex *index, J9ZipDirEntry *parent, const char *namePtr, UDATA nameSize, UDATA tag);
+static J9ZipFileEntry *zipCache_findFileEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
+static J9ZipDirEntry *zipCache_findDirEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
 
 #define ZIP_SRP_SET(field, value) WSRP_PTR_SET(&field, value)
 #define ZIP_SRP_GET(field, type) WSRP_PTR_GET(&field, type)
@@ -144,6 +164,9 @@ J9ZipCache *zipCache_new(J9PortLibrary * portLib, char *zipName, IDATA zipNameLe
 	zce->zipFileSize = zipFileSize;
 	zce->zipTimeStamp = zipTimeStamp;
 	zce->root.zipFileOffset = 1;
+
+	/* Failing to allocate the index is not fatal, lookups fall back to walking the lists */
+	ZIP_SRP_SET(zce->hashIndex, zipCache_indexAllocate(portLib, ZIP_INDEX_INITIAL_CAPACITY));
 	
 	return (J9ZipCache *)zci;
 }
@@ -246,6 +269,11 @@ UDATA zipCache_cacheSize(J9ZipCache * zipCache) {
 				separately rather than being reserved from the chunk */
 			sizeRequired += strlen((const char*)zipFileName) + 1;
 		}
+		/* The index is allocated separately from the chunks, the copy embeds one sized for the current count */
+		if (NULL != ZIP_SRP_GET(zce->hashIndex, J9ZipHashIndex *)) {
+			J9ZipHashIndex *index = ZIP_SRP_GET(zce->hashIndex, J9ZipHashIndex *);
+			sizeRequired += zipCache_indexSize(zipCache_indexCapacityFor(index->count));
+		}
 	}
 	return sizeRequired;
 }
@@ -301,6 +329,7 @@ BOOLEAN zipCache_copy(J9ZipCache * zipCache, void *cacheData, UDATA dataSize) {
 	J9ZipCacheEntry *zce;
 	J9ZipFileRecord *record;
 	J9ZipDirEntry *orgDirEntry;
+	J9ZipHashIndex *orgIndex = ZIP_SRP_GET(orgzce->hashIndex, J9ZipHashIndex *);
 	UDATA i;
 	char *copyZipFileName;
 	const char *zipFileName = ZIP_SRP_GET(orgzce->zipFileName, const char *);
@@ -331,6 +360,20 @@ BOOLEAN zipCache_copy(J9ZipCache * zipCache, void *cacheData, UDATA dataSize) {
 		return FALSE;
 	}
 	strcpy(copyZipFileName, zipFileName);
+
+	if (NULL != orgIndex) {
+		/* Reserve the index before the entries so it is populated as they are copied below */
+		UDATA capacity = zipCache_indexCapacityFor(orgIndex->count);
+		char *unused = NULL;
+		J9ZipHashIndex *index = (J9ZipHashIndex *)zipCache_reserveEntry(zce, chunk, zipCache_indexSize(capacity), 0, &unused);
+		if (NULL == index) {
+			return FALSE;
+		}
+		index->capacity = capacity;
+		index->flags = ZIP_INDEX_EMBEDDED;
+		ZIP_SRP_SET(zce->hashIndex, index);
+	}
+
 	zce->zipFileSize = orgzce->zipFileSize;
 	zce->zipTimeStamp = orgzce->zipTimeStamp;
 	zce->startCentralDir = orgzce->startCentralDir;
@@ -509,7 +552,7 @@ J9ZipDirEntry *zipCache_copyDirEntry(J9ZipCacheEntry *orgzce, J9ZipDirEntry *org
 	}
 	while (orgDirEntry) {
 		const char *orgName = J9ZIPDIRENTRY_NAME(orgDirEntry);
-		if (!(dirEntry = zipCache_addToDirList(NULL, zce, rootEntry, orgName, strlen(orgName), FALSE))) {
+		if (!(dirEntry = zipCache_addToDirList(NULL, zce, rootEntry, orgName, strlen(orgName), (orgDirEntry->zipFileOffset & ISCLASS_BIT) != 0))) {
 			return NULL;
 		}
 		dirEntry->zipFileOffset = orgDirEntry->zipFileOffset;
@@ -606,7 +649,7 @@ zipCache_addElement(J9ZipCache * zipCache, char *elementName, IDATA elementNameL
 			/* The prefix we're looking at doesn't end with a '/', which means */
 			/* it is really the suffix of the elementName, and it's a filename. */
 
-			fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+			fileEntry = zipCache_findFileEntry(zce, dirEntry, curName, curSize, isClass);
 			if(fileEntry) {
 				/* We've seen this file before...update the entry to the new offset. */
 				fileEntry->zipFileOffset = elementOffset | (isClass ? ISCLASS_BIT : 0);
@@ -620,7 +663,7 @@ zipCache_addElement(J9ZipCache * zipCache, char *elementName, IDATA elementNameL
 		/* If we got here, we're looking at a prefix which ends with '/' */
 		/* Treat that prefix as a subdirectory.  If it doesn't exist, create it implicitly */
 
-		if (!(d = zipCache_searchDirList(dirEntry, curName, curSize, isClass))) {
+		if (!(d = zipCache_findDirEntry(zce, dirEntry, curName, curSize, isClass))) {
 			if (!(d = zipCache_addToDirList(portLib, zce, dirEntry, curName, curSize, isClass))) {
 				return FALSE;
 			}
@@ -698,7 +741,7 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 			/* The prefix we're looking at doesn't end with a '/', which means */
 			/* it is really the suffix of the elementName, and it's a filename. */
 
-			fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+			fileEntry = zipCache_findFileEntry(zce, dirEntry, curName, curSize, isClass);
 			if (fileEntry) {
 				return fileEntry->zipFileOffset & OFFSET_MASK;
 			}
@@ -710,7 +753,7 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 		/* If we got here, we're looking at a prefix which ends with '/', or searchDirList is TRUE */
 		/* Treat that prefix as a subdirectory.  It will exist if elementName was added before. */
 
-		dirEntry = zipCache_searchDirList(dirEntry, curName, curSize, isClass);
+		dirEntry = zipCache_findDirEntry(zce, dirEntry, curName, curSize, isClass);
 		if (!dirEntry)
 			return NOT_FOUND;
 		curName += prefixSize;
@@ -742,6 +785,8 @@ void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
 		return;
 	}
 
+	zipCache_indexFree(portLib, zce);
+
 	chunk2 = (J9ZipChunkHeader *)(((U_8 *)zce) - sizeof(J9ZipChunkHeader));
 	if (((UDATA)(zipFileName - (U_8 *)chunk2)) >= ACTUAL_CHUNK_SIZE)   {
 		/* HACK!!  zce->info.zipFileName points outside the first chunk, therefore it was allocated
@@ -812,6 +857,7 @@ J9ZipDirEntry *zipCache_addToDirList(J9PortLibrary * portLib, J9ZipCacheEntry *z
 	entry->zipFileOffset = IMPLICIT_ENTRY | (isClass ? ISCLASS_BIT : 0);
 	memcpy(name, namePtr, nameSize);
 	/* name[nameSize] is already zero (NUL) */
+	zipCache_indexInsert(portLib, zce, dirEntry, entry, namePtr, nameSize, ZIP_INDEX_TAG_DIR | (isClass ? ZIP_INDEX_TAG_CLASS : 0));
 	return entry;
 }
 
@@ -864,6 +910,7 @@ haveEntry:
 	memcpy(name, namePtr, nameSize);
 	entry->nameLength = nameSize;
 	entry->zipFileOffset = elementOffset | (isClass ? ISCLASS_BIT : 0);
+	zipCache_indexInsert(portLib, zce, dirEntry, entry, namePtr, nameSize, isClass ? ZIP_INDEX_TAG_CLASS : 0);
 	return entry;
 }
 
@@ -998,6 +1045,224 @@ J9ZipFileEntry *zipCache_searchFileList(J9ZipDirEntry * dirEntry, const char *na
 
 
 
+/*
+ * The hash index maps (parent directory, name, isClass, file or directory) to the
+ * J9ZipFileEntry or J9ZipDirEntry so that zipCache_findElement() and
+ * zipCache_addElement() do not have to walk the per-directory lists, which are
+ * linear in the size of the package. The index is open addressed with linear
+ * probing, and every pointer in it is self-relative so that it remains valid
+ * when copied into the shared classes cache by zipCache_copy().
+ *
+ * Parents are hashed by their offset from the J9ZipCacheEntry rather than by
+ * address, so the hash of an entry is the same in every process that maps
+ * a copied cache.
+ *
+ * The index always contains every entry of the cache, or is absent. If it cannot
+ * grow, it is discarded and lookups fall back to zipCache_searchFileList() and
+ * zipCache_searchDirList().
+ */
+
+/* Returns the power of two capacity that holds count entries with a load factor of at most 3/4. */
+
+static UDATA
+zipCache_indexCapacityFor(UDATA count)
+{
+	UDATA capacity = ZIP_INDEX_INITIAL_CAPACITY;
+
+	while ((capacity * 3) < ((count + 1) * 4)) {
+		capacity *= 2;
+	}
+	return capacity;
+}
+
+
+
+/* Returns the size in bytes of an index with the specified capacity. */
+
+static UDATA
+zipCache_indexSize(UDATA capacity)
+{
+	return sizeof(J9ZipHashIndex) + ((capacity - 1) * sizeof(J9ZipHashSlot));
+}
+
+
+
+/* Allocates an empty, growable index. Returns NULL if portLib is NULL or the allocation fails. */
+
+static J9ZipHashIndex *
+zipCache_indexAllocate(J9PortLibrary *portLib, UDATA capacity)
+{
+	J9ZipHashIndex *index;
+	UDATA size = zipCache_indexSize(capacity);
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	if (NULL == portLib) {
+		return NULL;
+	}
+	index = (J9ZipHashIndex *) j9mem_allocate_memory(size, J9MEM_CATEGORY_VM_JCL);
+	if (NULL != index) {
+		memset(index, 0, size);
+		index->capacity = capacity;
+	}
+	return index;
+}
+
+
+
+/* Discards the index of zce. An index embedded in the chunk memory is only detached. */
+
+static void
+zipCache_indexFree(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
+{
+	J9ZipHashIndex *index = ZIP_SRP_GET(zce->hashIndex, J9ZipHashIndex *);
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	if (NULL != index) {
+		ZIP_SRP_SET_TO_NULL(zce->hashIndex);
+		if (J9_ARE_NO_BITS_SET(index->flags, ZIP_INDEX_EMBEDDED)) {
+			j9mem_free_memory(index);
+		}
+	}
+}
+
+
+
+/* Hashes namePtr[0..nameSize-1] within parent. The low ZIP_INDEX_TAG_SHIFT bits of the result hold tag. */
+
+static UDATA
+zipCache_indexHash(J9ZipCacheEntry *zce, J9ZipDirEntry *parent, const char *namePtr, UDATA nameSize, UDATA tag)
+{
+	UDATA hash = (UDATA)((U_8 *)parent - (U_8 *)zce);
+	UDATA i;
+
+	for (i = 0; i < nameSize; i++) {
+		hash = (hash * 31) + (U_8)namePtr[i];
+	}
+	hash ^= hash >> 16;
+	return (hash << ZIP_INDEX_TAG_SHIFT) | tag;
+}
+
+
+
+/* Places a slot for entry in index, which is known to have a free slot. */
+
+static void
+zipCache_indexPlace(J9ZipHashIndex *index, J9ZipDirEntry *parent, void *entry, UDATA hash)
+{
+	UDATA mask = index->capacity - 1;
+	UDATA i = (hash >> ZIP_INDEX_TAG_SHIFT) & mask;
+
+	while (0 != index->slots[i].entry) {
+		i = (i + 1) & mask;
+	}
+	ZIP_SRP_SET(index->slots[i].parent, parent);
+	ZIP_SRP_SET(index->slots[i].entry, entry);
+	index->slots[i].hash = hash;
+	index->count += 1;
+}
+
+
+
+/* Records a newly added file or directory entry in the index of zce, growing or discarding the index as required. */
+
+static void
+zipCache_indexInsert(J9PortLibrary *portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *parent, void *entry, const char *namePtr, UDATA nameSize, UDATA tag)
+{
+	J9ZipHashIndex *index = ZIP_SRP_GET(zce->hashIndex, J9ZipHashIndex *);
+
+	if (NULL == index) {
+		return;
+	}
+
+	if ((index->capacity * 3) < ((index->count + 1) * 4)) {
+		J9ZipHashIndex *newIndex = NULL;
+		UDATA i;
+
+		if (J9_ARE_NO_BITS_SET(index->flags, ZIP_INDEX_EMBEDDED)) {
+			newIndex = zipCache_indexAllocate(portLib, index->capacity * 2);
+		}
+		if (NULL == newIndex) {
+			zipCache_indexFree(portLib, zce);
+			return;
+		}
+		for (i = 0; i < index->capacity; i++) {
+			J9ZipHashSlot *slot = &index->slots[i];
+			if (0 != slot->entry) {
+				zipCache_indexPlace(newIndex, ZIP_SRP_GET(slot->parent, J9ZipDirEntry *), ZIP_SRP_GET(slot->entry, void *), slot->hash);
+			}
+		}
+		zipCache_indexFree(portLib, zce);
+		ZIP_SRP_SET(zce->hashIndex, newIndex);
+		index = newIndex;
+	}
+
+	zipCache_indexPlace(index, parent, entry, zipCache_indexHash(zce, parent, namePtr, nameSize, tag));
+}
+
+
+
+/* Returns the entry recorded in index for namePtr[0..nameSize-1] within parent, or NULL. */
+
+static void *
+zipCache_indexLookup(J9ZipCacheEntry *zce, J9ZipHashIndex *index, J9ZipDirEntry *parent, const char *namePtr, UDATA nameSize, UDATA tag)
+{
+	UDATA hash = zipCache_indexHash(zce, parent, namePtr, nameSize, tag);
+	UDATA mask = index->capacity - 1;
+	UDATA i = (hash >> ZIP_INDEX_TAG_SHIFT) & mask;
+
+	while (0 != index->slots[i].entry) {
+		J9ZipHashSlot *slot = &index->slots[i];
+		if ((slot->hash == hash) && (ZIP_SRP_GET(slot->parent, J9ZipDirEntry *) == parent)) {
+			void *entry = ZIP_SRP_GET(slot->entry, void *);
+			if (J9_ARE_ANY_BITS_SET(tag, ZIP_INDEX_TAG_DIR)) {
+				const char *name = J9ZIPDIRENTRY_NAME((J9ZipDirEntry *)entry);
+				if (!strncmp(name, namePtr, nameSize) && !name[nameSize]) {
+					return entry;
+				}
+			} else {
+				J9ZipFileEntry *fileEntry = (J9ZipFileEntry *)entry;
+				if ((fileEntry->nameLength == nameSize) && !memcmp(J9ZIPFILEENTRY_NAME(fileEntry), namePtr, nameSize)) {
+					return entry;
+				}
+			}
+		}
+		i = (i + 1) & mask;
+	}
+	return NULL;
+}
+
+
+
+/* Finds a file entry in dirEntry using the index if there is one, otherwise searching the fileList. */
+
+static J9ZipFileEntry *
+zipCache_findFileEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	J9ZipHashIndex *index = ZIP_SRP_GET(zce->hashIndex, J9ZipHashIndex *);
+
+	if (NULL == index) {
+		return zipCache_searchFileList(dirEntry, namePtr, nameSize, isClass);
+	}
+	return (J9ZipFileEntry *)zipCache_indexLookup(zce, index, dirEntry, namePtr, nameSize, isClass ? ZIP_INDEX_TAG_CLASS : 0);
+}
+
+
+
+/* Finds a directory entry in dirEntry using the index if there is one, otherwise searching the dirList. */
+
+static J9ZipDirEntry *
+zipCache_findDirEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	J9ZipHashIndex *index = ZIP_SRP_GET(zce->hashIndex, J9ZipHashIndex *);
+
+	if (NULL == index) {
+		return zipCache_searchDirList(dirEntry, namePtr, nameSize, isClass);
+	}
+	return (J9ZipDirEntry *)zipCache_indexLookup(zce, index, dirEntry, namePtr, nameSize, ZIP_INDEX_TAG_DIR | (isClass ? ZIP_INDEX_TAG_CLASS : 0));
+}
+
+
+
 /** 
  * Searches for a directory named elementName in zipCache and if found provides 
  * a handle to it that can be used to enumerate through all of the directory's files.
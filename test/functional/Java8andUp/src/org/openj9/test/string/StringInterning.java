@@ -154,6 +154,28 @@ public class StringInterning {
 
 	}
 
+	public void testCollidingStringsOfDifferentLengths() {
+		salt = "testCollidingStringsOfDifferentLengths";
+		/* a leading \u0000 contributes nothing to the hash, so all of these collide */
+		String[] interned = new String[4];
+		String prefix = "";
+		for (int i = 0; i < interned.length; ++i) {
+			interned[i] = (prefix + salt).intern();
+			AssertJUnit.assertEquals("expect colliding hashes", salt.hashCode(), interned[i].hashCode());
+			prefix = prefix + "\u0000";
+		}
+		for (int i = 0; i < interned.length; ++i) {
+			for (int j = 0; j < i; ++j) {
+				AssertJUnit.assertNotSame("expect interned[" + i + "] != interned[" + j + "]", interned[i], interned[j]);
+			}
+		}
+		/* the literals below are resolved by UTF8 lookup, which must find the strings interned above */
+		AssertJUnit.assertSame("expect literal 0 === interned[0]", interned[0], salt);
+		AssertJUnit.assertSame("expect literal 1 === interned[1]", interned[1], "\u0000testCollidingStringsOfDifferentLengths");
+		AssertJUnit.assertSame("expect literal 2 === interned[2]", interned[2], "\u0000\u0000testCollidingStringsOfDifferentLengths");
+		AssertJUnit.assertSame("expect literal 3 === interned[3]", interned[3], "\u0000\u0000\u0000testCollidingStringsOfDifferentLengths");
+	}
+
 	public void testImplicitInterning() {
 		String sObject = new String("testDeclaredField");
 		Field f = null;
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package j9vm.test.heapwalk;
+
+/**
+ * Compare j9mm_parallel_iterate_all_objects with j9mm_iterate_all_objects on the same heap,
+ * both for a complete walk and for walks whose callback aborts.
+ */
+public class ParallelHeapWalkTest {
+
+	static final String NATIVE_LIBRARY_NAME = "j9thrtestnatives" + System.getProperty("com.ibm.oti.vm.library.version");
+
+	/* Slots of the array filled in by walkHeap(), matching HEAPWALK_* in testnatives.c */
+	static final int SERIAL_COUNT = 0;
+	static final int PARALLEL_COUNT = 1;
+	static final int WORKERS_FINISHED = 2;
+	static final int WORKERS_INVALID = 3;
+	static final int SERIAL_REGION_ABORT_COUNT = 4;
+	static final int SERIAL_REGION_ABORT_RESULT = 5;
+	static final int PARALLEL_REGION_ABORT_COUNT = 6;
+	static final int PARALLEL_REGION_ABORT_RESULT = 7;
+	static final int PARALLEL_ABORT_COUNT = 8;
+	static final int PARALLEL_ABORT_RESULT = 9;
+	static final int RESULT_COUNT = 10;
+
+	/* jvmtiIterationControl */
+	static final long JVMTI_ITERATION_ABORT = 0;
+
+	static final int RETAINED_OBJECTS = 200000;
+
+	static Object[] retained;
+
+	/**
+	 * Walk the heap serially and in parallel under a single period of exclusive VM access.
+	 */
+	static native void walkHeap(long[] results);
+
+	public static void main(String[] args) {
+		try {
+			System.loadLibrary(NATIVE_LIBRARY_NAME);
+		} catch (UnsatisfiedLinkError e) {
+			System.out.println("Problem opening JNI library");
+			e.printStackTrace();
+			throw new RuntimeException();
+		}
+
+		/* populate enough of the heap that it spans several regions */
+		retained = new Object[RETAINED_OBJECTS];
+		for (int i = 0; i < RETAINED_OBJECTS; i++) {
+			retained[i] = (0 == (i % 2)) ? new Object() : new byte[i % 512];
+		}
+
+		long[] results = new long[RESULT_COUNT];
+		walkHeap(results);
+
+		check(results[SERIAL_COUNT] >= RETAINED_OBJECTS, "serial walk found " + results[SERIAL_COUNT] + " objects");
+		check(results[PARALLEL_COUNT] == results[SERIAL_COUNT],
+				"parallel walk found " + results[PARALLEL_COUNT] + " objects, serial walk found " + results[SERIAL_COUNT]);
+		check(results[WORKERS_FINISHED] >= 3, "workerFinish was called " + results[WORKERS_FINISHED] + " times for 3 walks");
+		check(results[WORKERS_INVALID] == 0, "workerFinish was passed " + results[WORKERS_INVALID] + " contexts not returned by workerStart");
+
+		/* with j9mm_iterator_flag_abort_region_only every region ends at its first object, however the regions are shared out */
+		check(results[SERIAL_REGION_ABORT_RESULT] == JVMTI_ITERATION_ABORT, "serial region abort walk did not report the abort");
+		check(results[PARALLEL_REGION_ABORT_RESULT] == JVMTI_ITERATION_ABORT, "parallel region abort walk did not report the abort");
+		check(results[SERIAL_REGION_ABORT_COUNT] >= 1, "serial region abort walk visited " + results[SERIAL_REGION_ABORT_COUNT] + " regions");
+		check(results[PARALLEL_REGION_ABORT_COUNT] == results[SERIAL_REGION_ABORT_COUNT],
+				"parallel region abort walk visited " + results[PARALLEL_REGION_ABORT_COUNT] + " regions, serial walk visited " + results[SERIAL_REGION_ABORT_COUNT]);
+
+		/* without the flag the walk stops early, but which regions were started before the abort depends on timing */
+		check(results[PARALLEL_ABORT_RESULT] == JVMTI_ITERATION_ABORT, "parallel abort walk did not report the abort");
+		check((results[PARALLEL_ABORT_COUNT] >= 1) && (results[PARALLEL_ABORT_COUNT] <= results[SERIAL_REGION_ABORT_COUNT]),
+				"parallel abort walk visited " + results[PARALLEL_ABORT_COUNT] + " objects");
+
+		System.out.println("Parallel heap walk visited " + results[PARALLEL_COUNT] + " objects in " + results[SERIAL_REGION_ABORT_COUNT] + " regions");
+	}
+
+	static void check(boolean condition, String message) {
+		if (!condition) {
+			System.out.println("***FAILED*** " + message);
+			throw new RuntimeException(message);
+		}
+	}
+}
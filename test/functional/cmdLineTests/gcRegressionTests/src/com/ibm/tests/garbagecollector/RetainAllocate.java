@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * This test allocates for the specified number of seconds while keeping the most recently allocated objects alive, so that
+ * every collection of the nursery (or Eden) has a large set of survivors to copy.  It was created to test that the balanced
+ * collector caps Eden to meet -Xgc:tarokPGCPauseTargetMillis.
+ */
+public class RetainAllocate
+{
+	private static final int RETAINED_OBJECT_COUNT = 48 * 1024;
+	private static final int OBJECT_SIZE = 1024;
+
+	public static Object[] _retained = new Object[RETAINED_OBJECT_COUNT];
+
+	/**
+	 * @param args Takes one argument:  number of seconds to allocate for before terminating with a message that the test ran to completion.
+	 * This argument is required.  It must be in the range [1-60]
+	 */
+	public static void main(String[] args)
+	{
+		if (1 == args.length)
+		{
+			int secondsToSpin = Integer.parseInt(args[0]);
+
+			if ((secondsToSpin >= 1) && (secondsToSpin <= 60))
+			{
+				long finishTime = System.currentTimeMillis() + (secondsToSpin * 1000);
+				int next = 0;
+				while (System.currentTimeMillis() < finishTime)
+				{
+					_retained[next] = new byte[OBJECT_SIZE];
+					next = (next + 1) % RETAINED_OBJECT_COUNT;
+				}
+				System.out.println("Test ran to completion");
+			}
+			else
+			{
+				System.err.println("Invalid option given for seconds (" + secondsToSpin + ").  Value given must be in the range [1-60].");
+				System.exit(2);
+			}
+		}
+		else
+		{
+			System.err.println("Missing argument for test run time.  Please specify the number of seconds desired for the test run (in the range [1-60]).");
+			System.exit(1);
+		}
+	}
+}